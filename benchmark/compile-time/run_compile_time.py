@@ -0,0 +1,97 @@
+#!/usr/bin/python
+# -*- coding: utf-8 -*-
+
+# ===--- run_compile_time.py ---------------------------------------------===//
+#
+#  This source file is part of the Swift.org open source project
+#
+#  Copyright (c) 2014 - 2018 Apple Inc. and the Swift project authors
+#  Licensed under Apache License v2.0 with Runtime Library Exception
+#
+#  See https://swift.org/LICENSE.txt for license information
+#  See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+#
+# ===---------------------------------------------------------------------===//
+#
+# Compile-time regression benchmark harness. Compiles each source in
+# sources/ with -stats-output-dir and reports the unified stats reporter's
+# timers and counters per benchmark, in the same delimiter-separated shape
+# compare_perf_tests.py consumes for runtime benchmarks:
+#
+#     run_compile_time.py --swiftc /path/to/swiftc [--num-samples N]
+#
+# Reported fields per (benchmark, counter): the minimum over the samples.
+
+from __future__ import print_function
+
+import argparse
+import glob
+import json
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+
+
+def collect_stats(stats_dir):
+    """Merge all stats JSON files the frontend left in stats_dir."""
+    merged = {}
+    for stats_file in glob.glob(os.path.join(stats_dir, '*.json')):
+        with open(stats_file) as contents:
+            merged.update(json.load(contents))
+    return merged
+
+
+def run_sample(swiftc, source, extra_args):
+    stats_dir = tempfile.mkdtemp(prefix='compile-time-stats-')
+    try:
+        subprocess.check_call(
+            [swiftc, '-frontend', '-typecheck', '-stats-output-dir',
+             stats_dir, source] + extra_args)
+        return collect_stats(stats_dir)
+    finally:
+        shutil.rmtree(stats_dir)
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Measure compiler throughput on stress sources.')
+    parser.add_argument('--swiftc', required=True,
+                        help='path to the swiftc to measure')
+    parser.add_argument('--num-samples', type=int, default=3,
+                        help='samples per benchmark; the minimum is reported')
+    parser.add_argument('--delim', default=',',
+                        help='output delimiter; default: ,')
+    parser.add_argument('--filter', default='',
+                        help='only run benchmarks containing this substring')
+    parser.add_argument('extra_args', nargs='*',
+                        help='extra arguments passed to the frontend')
+    args = parser.parse_args()
+
+    sources_dir = os.path.join(os.path.dirname(__file__), 'sources')
+    sources = sorted(glob.glob(os.path.join(sources_dir, '*.swift')))
+    if args.filter:
+        sources = [s for s in sources if args.filter in os.path.basename(s)]
+    if not sources:
+        print('error: no benchmark sources found', file=sys.stderr)
+        return 1
+
+    print(args.delim.join(['Benchmark', 'Counter', 'Min']))
+    for source in sources:
+        name = os.path.splitext(os.path.basename(source))[0]
+        best = {}
+        for _ in range(args.num_samples):
+            for counter, value in run_sample(args.swiftc, source,
+                                             args.extra_args).items():
+                if not isinstance(value, (int, float)):
+                    continue
+                if counter not in best or value < best[counter]:
+                    best[counter] = value
+        for counter in sorted(best):
+            print(args.delim.join([name, counter, str(best[counter])]))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
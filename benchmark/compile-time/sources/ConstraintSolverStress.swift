@@ -0,0 +1,23 @@
+// Stress source for the constraint solver: operator-heavy expressions with
+// literal type variables, the shape that dominates type-checking time in
+// builder-style code.
+
+func mixedArithmetic(_ x: Double) -> Double {
+  let a = 1 + 2 * 3 + x - 4 / 2 + 0.5
+  let b = a + 1.5 * 2.0 + Double(1 + 2 + 3) - 0.25
+  let c = (a + b) * (a - b) + (a / b) - (b / a)
+  return a + b + c
+}
+
+func tupleZips() -> [(Int, String)] {
+  let xs = [1, 2, 3, 4, 5, 6, 7, 8]
+  let ys = ["a", "b", "c", "d", "e", "f", "g", "h"]
+  return Array(zip(xs.map { $0 * 2 }, ys.map { $0 + "!" }))
+}
+
+func closureChains() -> Int {
+  let values = (0..<64).map { $0 * 3 }
+  return values.filter { $0 % 2 == 0 }
+               .map { $0 + 1 }
+               .reduce(0) { $0 + $1 }
+}
@@ -0,0 +1,39 @@
+// Stress source for the generic signature builder: protocol hierarchies with
+// associated type constraints and deeply constrained extensions, the shape
+// of collection-style libraries.
+
+protocol Layer0 { associatedtype Element }
+protocol Layer1: Layer0 where Element: Comparable {}
+protocol Layer2: Layer1 { associatedtype Index: Comparable }
+protocol Layer3: Layer2 where Index: Hashable {}
+protocol Layer4: Layer3 { associatedtype Slice: Layer2 }
+protocol Layer5: Layer4 where Slice.Element == Element {}
+
+struct Box<T: Comparable & Hashable>: Layer5 {
+  typealias Element = T
+  typealias Index = Int
+  typealias Slice = SubBox<T>
+}
+
+struct SubBox<T: Comparable & Hashable>: Layer2 {
+  typealias Element = T
+  typealias Index = Int
+}
+
+extension Layer5 where Element: Hashable, Index == Int {
+  func fingerprint(_ elements: [Element]) -> Int {
+    var hasher = Hasher()
+    for element in elements { hasher.combine(element) }
+    return hasher.finalize()
+  }
+}
+
+func deepCall<T: Layer5>(_ box: T, _ values: [T.Element]) -> [T.Element]
+    where T.Element: Hashable, T.Index == Int {
+  return values.sorted()
+}
+
+func useAll() -> Int {
+  let box = Box<Int>()
+  return box.fingerprint(deepCall(box, [3, 1, 2]))
+}
@@ -0,0 +1,58 @@
+// Stress source for enum layout (GenEnum): a large no-payload enum, a large
+// multi-payload enum, and exhaustive switches over both.
+
+enum Opcode {
+  case op00, op01, op02, op03, op04, op05, op06, op07
+  case op08, op09, op10, op11, op12, op13, op14, op15
+  case op16, op17, op18, op19, op20, op21, op22, op23
+  case op24, op25, op26, op27, op28, op29, op30, op31
+  case op32, op33, op34, op35, op36, op37, op38, op39
+  case op40, op41, op42, op43, op44, op45, op46, op47
+  case op48, op49, op50, op51, op52, op53, op54, op55
+  case op56, op57, op58, op59, op60, op61, op62, op63
+}
+
+enum Value {
+  case none
+  case integer(Int)
+  case real(Double)
+  case text(String)
+  case pair(Int, Int)
+  case triple(Int, Int, Int)
+  case list([Value])
+  case table([String: Int])
+}
+
+func category(_ op: Opcode) -> Int {
+  switch op {
+  case .op00, .op01, .op02, .op03: return 0
+  case .op04, .op05, .op06, .op07: return 1
+  case .op08, .op09, .op10, .op11: return 2
+  case .op12, .op13, .op14, .op15: return 3
+  case .op16, .op17, .op18, .op19: return 4
+  case .op20, .op21, .op22, .op23: return 5
+  case .op24, .op25, .op26, .op27: return 6
+  case .op28, .op29, .op30, .op31: return 7
+  case .op32, .op33, .op34, .op35: return 8
+  case .op36, .op37, .op38, .op39: return 9
+  case .op40, .op41, .op42, .op43: return 10
+  case .op44, .op45, .op46, .op47: return 11
+  case .op48, .op49, .op50, .op51: return 12
+  case .op52, .op53, .op54, .op55: return 13
+  case .op56, .op57, .op58, .op59: return 14
+  case .op60, .op61, .op62, .op63: return 15
+  }
+}
+
+func weight(_ value: Value) -> Int {
+  switch value {
+  case .none: return 0
+  case .integer(let i): return i
+  case .real(let d): return Int(d)
+  case .text(let s): return s.count
+  case .pair(let a, let b): return a + b
+  case .triple(let a, let b, let c): return a + b + c
+  case .list(let vs): return vs.count
+  case .table(let t): return t.count
+  }
+}
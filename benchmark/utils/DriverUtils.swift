@@ -46,9 +46,13 @@ struct TestConfig {
   /// number of iterations to measure the test for a specified sample time.
   let fixedNumIters: UInt
 
-  /// The number of samples we should take of each test.
   let numSamples: Int
 
+  /// If true, rejects sample outliers (more than three scaled MADs from the
+  /// median) before reporting statistics, so CI comparisons gate on the
+  /// stable population instead of scheduler noise.
+  let rejectOutliers: Bool
+
   /// Is verbose output enabled?
   let verbose: Bool
 
@@ -70,6 +74,7 @@ struct TestConfig {
       var delim: String?
       var tags, skipTags: Set<BenchmarkCategory>?
       var numSamples, afterRunSleep: Int?
+      var rejectOutliers: Bool?
       var fixedNumIters: UInt?
       var sampleTime: Double?
       var verbose: Bool?
@@ -103,6 +108,9 @@ struct TestConfig {
     p.addArgument("--sample-time", \.sampleTime,
                   help: "duration of test measurement in seconds\ndefault: 1",
                   parser: finiteDouble)
+    p.addArgument("--reject-outliers", \.rejectOutliers, defaultValue: true,
+                  help: "reject sample outliers (> 3 scaled MADs from the\n" +
+                        "median) before reporting statistics")
     p.addArgument("--verbose", \.verbose, defaultValue: true,
                   help: "increase output verbosity")
     p.addArgument("--memory", \.logMemory, defaultValue: true,
@@ -132,6 +140,7 @@ struct TestConfig {
     sampleTime = c.sampleTime ?? 1.0
     fixedNumIters = c.fixedNumIters ?? 0
     numSamples = c.numSamples ?? 1
+    rejectOutliers = c.rejectOutliers ?? false
     verbose = c.verbose ?? false
     logMemory = c.logMemory ?? false
     afterRunSleep = c.afterRunSleep
@@ -236,6 +245,23 @@ func internalMedian(_ inputs: [UInt64]) -> UInt64 {
   return inputs.sorted()[inputs.count / 2]
 }
 
+/// Return the samples with outliers rejected: points farther than three
+/// scaled median absolute deviations from the median are dropped. The MAD is
+/// a robust spread estimate, so a handful of scheduler hiccups don't widen
+/// the acceptance band the way they inflate the standard deviation.
+func internalRejectOutliers(_ samples: [UInt64]) -> [UInt64] {
+  let median = Int64(internalMedian(samples))
+  let deviations = samples.map { UInt64(abs(Int64($0) - median)) }
+  let mad = internalMedian(deviations)
+  // No spread means the measurement is already stable.
+  if mad == 0 { return samples }
+  // 1.4826 scales the MAD to the standard deviation of a normal
+  // distribution; three of those is the conventional cut.
+  let cutoff = Int64((Double(mad) * 1.4826 * 3).rounded(.up))
+  let filtered = samples.filter { abs(Int64($0) - median) <= cutoff }
+  return filtered.isEmpty ? samples : filtered
+}
+
 #if SWIFT_RUNTIME_ENABLE_LEAK_CHECKER
 
 @_silgen_name("_swift_leaks_startTrackingObjects")
@@ -400,12 +426,19 @@ func runBench(_ test: BenchmarkInfo, _ c: TestConfig) -> BenchResults? {
   }
   test.tearDownFunction?()
 
-  let (mean, sd) = internalMeanSD(samples)
+  let reportedSamples =
+    c.rejectOutliers ? internalRejectOutliers(samples) : samples
+  if c.verbose && reportedSamples.count != samples.count {
+    print("    Rejected \(samples.count - reportedSamples.count) outlier(s).")
+  }
+
+  let (mean, sd) = internalMeanSD(reportedSamples)
 
   // Return our benchmark results.
-  return BenchResults(sampleCount: UInt64(samples.count),
-                      min: samples.min()!, max: samples.max()!,
-                      mean: mean, sd: sd, median: internalMedian(samples),
+  return BenchResults(sampleCount: UInt64(reportedSamples.count),
+                      min: reportedSamples.min()!, max: reportedSamples.max()!,
+                      mean: mean, sd: sd,
+                      median: internalMedian(reportedSamples),
                       maxRSS: UInt64(sampler.measureMemoryUsage()))
 }
 
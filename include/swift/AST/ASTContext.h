@@ -36,6 +36,7 @@
 #include "llvm/ADT/TinyPtrVector.h"
 #include "llvm/Support/Allocator.h"
 #include <functional>
+#include <atomic>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -219,6 +220,13 @@ public:
   /// Diags - The diagnostics engine.
   DiagnosticEngine &Diags;
 
+  /// If non-null, long-running semantic operations (currently the
+  /// expression constraint solver) poll this flag and abandon their work at
+  /// the next safe point once it is raised. IDE clients use it to preempt
+  /// requests that have become stale; any results produced by a cancelled
+  /// operation must be discarded.
+  std::atomic<bool> *CancellationFlag = nullptr;
+
   /// The request-evaluator that is used to process various requests.
   Evaluator evaluator;
 
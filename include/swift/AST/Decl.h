@@ -3794,6 +3794,16 @@ class ProtocolDecl final : public NominalTypeDecl {
   /// by this protocol.
   const Requirement *RequirementSignature = nullptr;
 
+  /// The transitive closure of protocols this protocol inherits from,
+  /// cached for refinement queries once the requirement signature has been
+  /// computed (before that, the inheritance clause may still be unresolved
+  /// and the closure must be re-walked). The contained null marker
+  /// distinguishes "not yet cached" from a protocol with no inherited
+  /// protocols.
+  Optional<ArrayRef<ProtocolDecl *>> InheritedProtocolsClosure;
+
+  ArrayRef<ProtocolDecl *> computeInheritedProtocolsClosure();
+
   bool requiresClassSlow();
 
   bool existentialConformsToSelfSlow();
@@ -63,6 +63,7 @@ namespace swift {
   class LinkLibrary;
   class LookupCache;
   class ModuleLoader;
+  class ModuleSourceLookupCache;
   class NominalTypeDecl;
   class EnumElementDecl;
   class OperatorDecl;
@@ -209,6 +210,11 @@ private:
     unsigned HasResolvedImports : 1;
   } Flags;
 
+  /// A merged top-level lookup cache over all of the module's source files,
+  /// used (and kept up to date) by lookupValue when every file of the module
+  /// is a name-bound source file. Owned by the ASTContext's cleanup list.
+  mutable ModuleSourceLookupCache *MergedSourceLookupCache = nullptr;
+
   ModuleDecl(Identifier name, ASTContext &ctx);
 
 public:
@@ -114,6 +114,12 @@ public:
   /// Assume that code will be executed in a single-threaded environment.
   bool AssumeSingleThreaded = false;
 
+  /// Assume that no class is subclassed outside of the statically linked
+  /// image and that the entire class hierarchy of that image is visible to
+  /// this compilation, so devirtualization may treat non-open class members
+  /// from other modules as statically knowable.
+  bool AssumeSealedClasses = false;
+
   /// Indicates which sanitizer is turned on.
   OptionSet<SanitizerKind> Sanitizers;
 
@@ -205,6 +205,39 @@ public:
   void cacheResult(bool value) const;
 };
 
+/// Request that the body of the given function be type checked.
+///
+/// The result is true if an error occurred while checking the body. The
+/// result is memoized in the function's body state, so a body is checked at
+/// most once until it is explicitly reset (e.g. when an IDE client replaces
+/// the body after an edit); re-evaluating the request for an unchanged
+/// declaration is then a cache hit rather than a re-check.
+class TypeCheckFunctionBodyRequest :
+    public SimpleRequest<TypeCheckFunctionBodyRequest,
+                         CacheKind::SeparatelyCached,
+                         bool,
+                         AbstractFunctionDecl *> {
+public:
+  using SimpleRequest::SimpleRequest;
+
+private:
+  friend class SimpleRequest;
+
+  // Evaluation.
+  bool evaluate(Evaluator &evaluator, AbstractFunctionDecl *func) const;
+
+public:
+  // Cycle handling
+  bool breakCycle() const;
+  void diagnoseCycle(DiagnosticEngine &diags) const;
+  void noteCycleStep(DiagnosticEngine &diags) const;
+
+  // Separate caching.
+  bool isCached() const { return true; }
+  Optional<bool> getCachedResult() const;
+  void cacheResult(bool value) const;
+};
+
 /// The zone number for the type checker.
 #define SWIFT_TYPE_CHECKER_REQUESTS_TYPEID_ZONE 10
 
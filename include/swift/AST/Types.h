@@ -260,6 +260,13 @@ class alignas(1 << TypeAlignInBits) TypeBase {
   /// otherwise lazily populated by ASTContext when the canonical form of a
   /// non-canonical type is requested. The disposition of the union is stored
   /// outside of the union for performance. See Bits.TypeBase.IsCanonical.
+  ///
+  /// Note for anyone sizing a "precomputed structural hash for fast
+  /// inequality": canonical equality is already pointer identity, and this
+  /// field memoizes canonicalization, so a sugared node pays the recursive
+  /// walk once and a pointer load thereafter. A per-node 64-bit hash would
+  /// grow every type node (the property bitfields have no spare 64 bits)
+  /// to speed up only the *first* canonicalization of each sugared node.
   union {
     CanType CanonicalType;
     const ASTContext *Context;
@@ -58,6 +58,15 @@ namespace swift {
 
 /// A vector of bits.  This data structure is optimized to store an
 /// empty vector of any size without doing any allocation.
+///
+/// Performance shape: operations already work a 64-bit chunk at a time
+/// (population counts use hardware popcount; the chunkwise loops in the
+/// logical operations are trivially auto-vectorizable), a vector of any
+/// length that is all-clear is a single inline word, and one non-empty
+/// chunk stores inline. The remaining allocation cost is for *set* bits
+/// beyond 64 — e.g. 65–128-bit spare-bit masks — and removing it means
+/// widening the inline representation, which is packed into tagged
+/// size_t fields below and would grow the type everywhere it's embedded.
 class ClusteredBitVector {
   using ChunkType = uint64_t;
   static_assert(std::is_unsigned<ChunkType>::value, "ChunkType must be unsigned");
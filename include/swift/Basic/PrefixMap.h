@@ -15,6 +15,11 @@
 //  variant known as a ternary search tree.  In performance, it is similar
 //  to a binary tree; however, it has two properties specific to the use of
 //  homogeneous sequences as keys:
+//
+//  Note for profilers: despite the name, this structure does not back the
+//  mangler's substitution machinery — substitution lookups there are hash
+//  probes on DenseMap/StringMap (see Mangler::tryMangleSubstitution).  The
+//  clients of this map are EncodedSequence and the debug-info prefix map.
 // 
 //    - Individual entries do not necessarily store the entire key; instead,
 //      the key data may be spread over a sequence of nodes.  This causes the
@@ -174,6 +174,16 @@ public:
 };
 
 // This is a non-nested type just to make it less work to write at call sites.
+//
+// Cost notes, for anyone trying to leave tracing on in production: with a
+// reporter attached but event tracing off, a tracer costs two recursive-timer
+// updates (string-map probes). With -trace-stats-events on, each entry/exit
+// additionally pays a getrusage-based TimeRecord read and a delta over the
+// whole always-on counter struct; both are inherent to what the trace
+// records (process times and counter deltas), so a cheaper binary sink would
+// shrink the output files but not this per-event collection cost. A
+// two-rdtsc-reads tracer requires recording wall-clock-only events and
+// dropping the counter deltas — a different, coarser artifact.
 class FrontendStatsTracer
 {
   FrontendStatsTracer(UnifiedStatsReporter *Reporter,
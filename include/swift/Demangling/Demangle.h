@@ -21,8 +21,10 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 #include <cassert>
 #include <cstdint>
+#include "llvm/ADT/ArrayRef.h"
 #include "llvm/ADT/StringRef.h"
 #include "swift/Runtime/Config.h"
 
@@ -302,6 +304,13 @@ class Demangler;
 class Context {
   Demangler *D;
 
+  class SymbolCache;
+
+  /// A bounded cache of demangled symbol strings, created lazily by
+  /// demangleSymbolAsString. It survives clear(), which only recycles node
+  /// memory.
+  SymbolCache *Cache = nullptr;
+
   friend class Node;
 
 public:
@@ -340,6 +349,16 @@ public:
   std::string demangleSymbolAsString(llvm::StringRef MangledName,
                             const DemangleOptions &Options = DemangleOptions());
 
+  /// Demangle a batch of symbols and return their readable names.
+  ///
+  /// The context's node memory is recycled between the entries, so the peak
+  /// memory use is bounded by the largest single demangling rather than the
+  /// batch, which matters for symbolication services processing millions of
+  /// frames.
+  std::vector<std::string> demangleSymbolsAsStrings(
+      llvm::ArrayRef<llvm::StringRef> MangledNames,
+      const DemangleOptions &Options = DemangleOptions());
+
   /// Demangle the given type and return the readable name.
   ///
   /// \param MangledName The mangled type string, which does _not_ start with
@@ -503,6 +522,10 @@ class DemanglerPrinter {
 public:
   DemanglerPrinter() = default;
 
+  /// Pre-allocate space for at least \p size characters, so bulk printing
+  /// doesn't grow the buffer by doubling.
+  void reserve(size_t size) { Stream.reserve(size); }
+
   DemanglerPrinter &operator<<(llvm::StringRef Value) & {
     Stream.append(Value.data(), Value.size());
     return *this;
@@ -138,9 +138,16 @@ public:
     Status status = UpToDate;
     llvm::sys::TimePoint<> previousModTime;
 
+    /// How long the file took to compile in the previous build, in
+    /// milliseconds, or 0 if unknown. Used to bin-pack batch jobs by
+    /// measured cost instead of file count.
+    uint32_t previousBuildDurationMillis = 0;
+
     InputInfo() = default;
-    InputInfo(Status stat, llvm::sys::TimePoint<> time)
-        : status(stat), previousModTime(time) {}
+    InputInfo(Status stat, llvm::sys::TimePoint<> time,
+              uint32_t durationMillis = 0)
+        : status(stat), previousModTime(time),
+          previousBuildDurationMillis(durationMillis) {}
 
     static InputInfo makeNewlyAdded() {
       return InputInfo(Status::NewlyAdded, llvm::sys::TimePoint<>::max());
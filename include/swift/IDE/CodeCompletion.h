@@ -17,6 +17,7 @@
 #include "swift/Basic/LLVM.h"
 #include "llvm/ADT/ArrayRef.h"
 #include "llvm/ADT/StringRef.h"
+#include "llvm/ADT/StringMap.h"
 #include "llvm/Support/Allocator.h"
 #include "llvm/Support/TrailingObjects.h"
 #include <functional>
@@ -787,8 +788,19 @@ struct CodeCompletionResultSink {
   /// clang::Module * or swift::ModuleDecl *.
   std::pair<void *, StringRef> LastModule;
 
+  /// Interning table for chunk text copied into this sink. Type annotations
+  /// and keywords repeat endlessly across a large result set; storing each
+  /// distinct string once keeps completion memory proportional to the
+  /// number of distinct strings instead of the number of chunks. The key
+  /// storage lives in \c Allocator, so results imported into other sinks
+  /// (which retain the allocator, not the sink) keep their text alive.
+  /// (A StringMap rather than a StringSet: only the former has the
+  /// allocator-forwarding constructor needed for a reference allocator.)
+  llvm::StringMap<char, llvm::BumpPtrAllocator &> InternedStrings;
+
   CodeCompletionResultSink()
-      : Allocator(std::make_shared<llvm::BumpPtrAllocator>()) {}
+      : Allocator(std::make_shared<llvm::BumpPtrAllocator>()),
+        InternedStrings(*Allocator) {}
 };
 
 class CodeCompletionContext {
@@ -850,6 +862,19 @@ struct SimpleCachingCodeCompletionConsumer : public CodeCompletionConsumer {
   /// Clients should override this method to receive \p Results.
   virtual void handleResults(
       MutableArrayRef<CodeCompletionResult *> Results) = 0;
+
+  /// Override and return true to receive results in ranked chunks through
+  /// handleResultChunk instead of a single handleResults call: the
+  /// context-specific results (locals, members, keywords) are delivered
+  /// first, as soon as they are ready, followed by one chunk per cached
+  /// module of global results. A streaming client can paint the first chunk
+  /// without waiting for the (much larger) global ones.
+  virtual bool wantsChunkedResults() const { return false; }
+
+  /// Receives one chunk of results when wantsChunkedResults() is true.
+  /// \p isLastChunk is true for the final chunk of the request.
+  virtual void handleResultChunk(
+      MutableArrayRef<CodeCompletionResult *> Results, bool isLastChunk) {}
 };
 
 /// \brief A code completion result consumer that prints the results to a
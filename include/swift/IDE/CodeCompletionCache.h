@@ -55,6 +55,12 @@ public:
 
   struct Value : public llvm::ThreadSafeRefCountedBase<Value> {
     llvm::sys::TimePoint<> ModuleModificationTime;
+
+    /// Hash of the module file's contents, used to revalidate the entry when
+    /// the modification time changes but the module itself does not (e.g.
+    /// after a branch switch). 0 if unknown.
+    uint64_t ModuleContentHash = 0;
+
     CodeCompletionResultSink Sink;
   };
   using ValueRefCntPtr = llvm::IntrusiveRefCntPtr<Value>;
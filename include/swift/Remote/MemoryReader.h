@@ -21,11 +21,13 @@
 #include "swift/Remote/RemoteAddress.h"
 #include "swift/SwiftRemoteMirror/MemoryReaderInterface.h"
 
+#include <algorithm>
 #include <cstring>
 #include <functional>
 #include <memory>
 #include <string>
 #include <tuple>
+#include <unordered_map>
 
 namespace swift {
 namespace remote {
@@ -100,6 +102,85 @@ public:
   virtual ~MemoryReader() = default;
 };
 
+/// A memory reader which combines reads of an underlying reader.
+///
+/// Reads are performed in fixed-size aligned blocks which are cached, so the
+/// many small reads issued while walking remote data structures — e.g.
+/// resolving metadata for millions of heap objects over a slow remote
+/// interface — are served by a much smaller number of actual round trips.
+///
+/// The cache assumes the inspected address space does not change while the
+/// reader is in use (a suspended process or a core file).
+class CachingMemoryReader : public MemoryReader {
+  std::shared_ptr<MemoryReader> Underlying;
+
+  static constexpr uint64_t BlockSize = 4096;
+
+  /// Bound the cache; when full it is flushed wholesale, which keeps hot
+  /// blocks cheap to refetch without per-block bookkeeping.
+  static constexpr size_t MaxCachedBlocks = 4096;
+
+  std::unordered_map<uint64_t, std::unique_ptr<uint8_t[]>> Blocks;
+
+  uint8_t *getBlock(uint64_t base) {
+    auto cached = Blocks.find(base);
+    if (cached != Blocks.end())
+      return cached->second.get();
+
+    auto buffer = std::unique_ptr<uint8_t[]>(new uint8_t[BlockSize]);
+    if (!Underlying->readBytes(RemoteAddress(base), buffer.get(), BlockSize))
+      return nullptr;
+    if (Blocks.size() >= MaxCachedBlocks)
+      Blocks.clear();
+    auto *result = buffer.get();
+    Blocks[base] = std::move(buffer);
+    return result;
+  }
+
+public:
+  explicit CachingMemoryReader(std::shared_ptr<MemoryReader> underlying)
+      : Underlying(std::move(underlying)) {}
+
+  bool queryDataLayout(DataLayoutQueryType type, void *inBuffer,
+                       void *outBuffer) override {
+    return Underlying->queryDataLayout(type, inBuffer, outBuffer);
+  }
+
+  RemoteAddress getSymbolAddress(const std::string &name) override {
+    return Underlying->getSymbolAddress(name);
+  }
+
+  bool readString(RemoteAddress address, std::string &dest) override {
+    return Underlying->readString(address, dest);
+  }
+
+  bool readBytes(RemoteAddress address, uint8_t *dest,
+                 uint64_t size) override {
+    // Only combine small reads; large ones already amortize their round
+    // trip and would just churn the cache.
+    if (size == 0 || size > BlockSize)
+      return Underlying->readBytes(address, dest, size);
+
+    uint64_t addr = address.getAddressData();
+    while (size > 0) {
+      uint64_t blockBase = addr & ~(BlockSize - 1);
+      uint64_t offset = addr - blockBase;
+      uint64_t chunk = std::min(size, BlockSize - offset);
+      auto *block = getBlock(blockBase);
+      if (!block) {
+        // The enclosing block may straddle an unmapped page even though the
+        // requested range itself is readable; fall back to a direct read.
+        return Underlying->readBytes(RemoteAddress(addr), dest, size);
+      }
+      memcpy(dest, block + offset, chunk);
+      dest += chunk;
+      addr += chunk;
+      size -= chunk;
+    }
+    return true;
+  }
+};
+
 } // end namespace reflection
 } // end namespace swift
 
@@ -277,9 +277,16 @@ class ConcurrentMap
   ///   std::atomic<Node*> Root;
   using super::Root;
 
-  /// This member stores the address of the last node that was found by the
-  /// search procedure. We cache the last search to accelerate code that
-  /// searches the same value in a loop.
+  /// This member stores the address of the last node that was inserted by
+  /// this map. We cache the last insertion to accelerate code that searches
+  /// the same value in a loop right after creating it, which is the common
+  /// access pattern for the metadata caches.
+  ///
+  /// The cache is deliberately not updated on lookup hits: lookups of
+  /// already-present keys are completely read-only, so any number of threads
+  /// can run them concurrently without bouncing a cache line between cores.
+  /// The map is append-only, which also means readers never need hazard
+  /// pointers or other deferred-reclamation machinery to stay safe.
   std::atomic<Node*> LastSearch;
 
 public:
@@ -315,19 +322,20 @@ public:
   /// \returns a pointer to the value or null if the value is not in the map.
   template <class KeyTy>
   EntryTy *find(const KeyTy &key) {
-    // Check if we are looking for the same key that we looked for in the last
-    // time we called this function.
-    if (Node *last = LastSearch.load(std::memory_order_acquire)) {
-      if (last->Payload.compareWithKey(key) == 0)
-        return &last->Payload;
-    }
-
-    // Search the tree, starting from the root.
+    // Check if we are looking for the entry that was most recently created
+    // by this map.
+    Node *last = LastSearch.load(std::memory_order_acquire);
+    if (last && last->Payload.compareWithKey(key) == 0)
+      return &last->Payload;
+
+    // Search the tree, starting from the root. Note that we deliberately
+    // don't update LastSearch here: a hit must stay read-only so that
+    // concurrent lookups of disjoint keys don't ping-pong the cache line
+    // between cores.
     Node *node = Root.load(std::memory_order_acquire);
     while (node) {
       int comparisonResult = node->Payload.compareWithKey(key);
       if (comparisonResult == 0) {
-        LastSearch.store(node, std::memory_order_release);
         return &node->Payload;
       } else if (comparisonResult < 0) {
         node = node->Left.load(std::memory_order_acquire);
@@ -345,12 +353,11 @@ public:
   ///   or already existed (false)
   template <class KeyTy, class... ArgTys>
   std::pair<EntryTy*, bool> getOrInsert(KeyTy key, ArgTys &&... args) {
-    // Check if we are looking for the same key that we looked for the
-    // last time we called this function.
-    if (Node *last = LastSearch.load(std::memory_order_acquire)) {
-      if (last && last->Payload.compareWithKey(key) == 0)
-        return { &last->Payload, false };
-    }
+    // Check if we are looking for the entry that was most recently created
+    // by this map.
+    Node *last = LastSearch.load(std::memory_order_acquire);
+    if (last && last->Payload.compareWithKey(key) == 0)
+      return { &last->Payload, false };
 
     // The node we allocated.
     Node *newNode = nullptr;
@@ -375,8 +382,8 @@ public:
           // Destroy the node we allocated before if we're carrying one around.
           if (newNode) this->destroyNode(newNode);
 
-          // Cache and report that we found an existing node.
-          LastSearch.store(node, std::memory_order_release);
+          // Report that we found an existing node. As in find(), a hit is
+          // deliberately read-only.
           return { &node->Payload, false };
         }
 
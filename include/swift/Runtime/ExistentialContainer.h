@@ -18,6 +18,15 @@
 namespace swift {
 
 /// The basic layout of an opaque (non-class-bounded) existential type.
+///
+/// Values which do not fit the inline buffer are stored in a reference
+/// counted copy-on-write box: copying or assigning the existential then
+/// only copies the box reference and adjusts its reference count (see
+/// ExistentialMetadataImpl.h on the runtime side and the boxed-existential
+/// buffer functions in IRGen's GenExistential.cpp), and mutating through
+/// the container first uniques the box via swift_makeBoxUnique. As a
+/// result, passing a large value around as `Any` is a pointer copy; the
+/// value itself is only copied when a shared box is mutated.
 template <typename Runtime>
 struct TargetOpaqueExistentialContainer {
   TargetValueBuffer<Runtime> Buffer;
@@ -17,4 +17,35 @@
 #ifndef SWIFT_RUNTIME_HEAP_H
 #define SWIFT_RUNTIME_HEAP_H
 
+#include <stddef.h>
+
+#include "swift/Runtime/Config.h"
+
+namespace swift {
+
+/// Callbacks through which a process can observe every allocation and
+/// deallocation the Swift heap performs, for production memory telemetry
+/// without dyld interposing.
+///
+/// The callbacks run inline in swift_slowAlloc / swift_slowDealloc on
+/// arbitrary threads; they must be async-signal-tolerant with respect to the
+/// Swift runtime (in particular, they must not allocate Swift objects).
+/// \c size is the requested allocation size; on deallocation it is the size
+/// the caller provided, which may be 0 when unknown.
+struct SwiftHeapObserver {
+  void (*allocated)(void *context, void *pointer, size_t size);
+  void (*deallocated)(void *context, void *pointer, size_t size);
+  void *context;
+};
+
+/// Register a heap observer. The registration is publish-once: it succeeds
+/// and returns true only if no observer has been registered yet, and the
+/// observer must stay valid for the remainder of the process lifetime. When
+/// no observer is registered, the only cost on the allocation paths is one
+/// relaxed atomic load and a well-predicted branch.
+SWIFT_RUNTIME_EXPORT
+bool swift_setHeapObserver(const SwiftHeapObserver *observer);
+
+} // end namespace swift
+
 #endif /* SWIFT_RUNTIME_HEAP_H */
@@ -150,6 +150,12 @@ void swift_slowDealloc(void *ptr, size_t bytes, size_t alignMask);
 SWIFT_RUNTIME_EXPORT
 HeapObject *swift_retain(HeapObject *object);
 
+/// Retain a whole buffer of object references with one call. The references
+/// may be of unknown origin (Swift or Objective-C); null entries are
+/// permitted and ignored.
+SWIFT_CC(swift) SWIFT_RUNTIME_STDLIB_API
+void swift_bulkRetain(void *const *objects, size_t count);
+
 SWIFT_RUNTIME_EXPORT
 HeapObject *swift_retain_n(HeapObject *object, uint32_t n);
 
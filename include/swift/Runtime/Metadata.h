@@ -766,6 +766,25 @@ void verifyMangledNameRoundtrip(const Metadata *metadata);
 SWIFT_CC(swift) SWIFT_RUNTIME_STDLIB_API
 const TypeContextDescriptor *swift_getTypeContextDescriptor(const Metadata *type);
 
+/// A snapshot of the memory retained by the runtime's metadata allocator,
+/// which backs the generic metadata instantiation caches and related
+/// runtime caches. Metadata is never evicted — its address is its
+/// identity — so in processes instantiating many distinct generic
+/// specializations these numbers grow monotonically; this accounting
+/// exists to let long-running processes attribute that growth.
+struct MetadataAllocationStatistics {
+  /// Bytes carved from the metadata allocation pool.
+  size_t PoolBytesAllocated;
+  /// Bytes of oversized allocations served directly by malloc.
+  size_t MallocBytesAllocated;
+};
+
+/// Returns a snapshot of the runtime's metadata allocation statistics.
+/// Counters are maintained with relaxed atomics; the snapshot is
+/// approximate under concurrent instantiation but never loses memory.
+SWIFT_RUNTIME_EXPORT
+MetadataAllocationStatistics swift_getMetadataAllocationStatistics();
+
 } // end namespace swift
 
 #endif // SWIFT_RUNTIME_METADATA_H
@@ -45,6 +45,7 @@
 #include "llvm/ADT/ilist.h"
 #include "llvm/ProfileData/InstrProfReader.h"
 #include "llvm/Support/Allocator.h"
+#include "llvm/Support/Mutex.h"
 #include "llvm/Support/raw_ostream.h"
 #include <functional>
 
@@ -146,6 +147,27 @@ private:
   /// Allocator that manages the memory of all the pieces of the SILModule.
   mutable llvm::BumpPtrAllocator BPA;
 
+  /// Parameters of the instruction allocator: instructions are carved from
+  /// \c BPA at a fixed alignment with a size-storing header, rounded up to
+  /// a granule, and deleted instructions are recycled through per-size-class
+  /// free lists instead of going back to malloc.
+  enum : unsigned {
+    InstAllocationAlignment = 16,
+    InstFreeListGranularity = 64,
+    NumInstFreeLists = 16,
+  };
+
+  /// Heads of the per-size-class free lists of recycled instruction memory.
+  /// The links are stored in the dead allocations themselves.
+  mutable void *InstFreeLists[NumInstFreeLists] = {};
+
+  /// Guards \c BPA and \c InstFreeLists. Instructions are created and
+  /// deleted from worker threads when the pass manager runs function
+  /// pipelines in parallel (-sil-opt-parallel-threads), so the shared
+  /// allocator state needs a lock; it is uncontended in the default
+  /// single-threaded configuration.
+  mutable llvm::sys::Mutex AllocationLock;
+
   /// The swift Module associated with this SILModule.
   ModuleDecl *TheSwiftModule;
 
@@ -512,6 +534,12 @@ public:
   /// succeeded, false otherwise.
   bool loadFunction(SILFunction *F);
 
+  /// Attempt to deserialize the SILFunction with the given name from any of
+  /// the known serialized modules, including its body.
+  ///
+  /// \return null if no serialized module contains such a function.
+  SILFunction *loadFunction(StringRef Name);
+
   /// Attempt to link the SILFunction. Returns true if linking succeeded, false
   /// otherwise.
   ///
@@ -20,6 +20,7 @@
 #include "llvm/ADT/Optional.h"
 #include "llvm/ADT/SmallVector.h"
 #include "llvm/Support/Casting.h"
+#include "llvm/Support/Mutex.h"
 #include <vector>
 
 namespace swift {
@@ -180,6 +181,13 @@ protected:
   /// Maps functions to their analysis provider.
   StorageTy storage;
 
+  /// Guards \c storage: worker threads look up and construct per-function
+  /// info concurrently when the pass manager runs function pipelines in
+  /// parallel. Recursive, because computing one function's info may request
+  /// info for another function of the same analysis. Uncontended in the
+  /// default single-threaded configuration.
+  mutable llvm::sys::Mutex storageLock;
+
   /// Construct a new empty function info for a specific function \p F.
   virtual FunctionInfoTy *newFunctionAnalysis(SILFunction *f) = 0;
 
@@ -192,6 +200,7 @@ protected:
   virtual void verify(FunctionInfoTy *funcInfo) const {}
 
   void deleteAllAnalysisProviders() {
+    llvm::sys::ScopedLock lock(storageLock);
     for (auto iter : storage)
       delete iter.second;
     storage.clear();
@@ -200,11 +209,15 @@ protected:
 public:
   /// Returns true if we have data for a specific function \p F without actually
   /// attempting to construct the function info.
-  bool hasFunctionInfo(SILFunction *f) const { return storage.count(f); }
+  bool hasFunctionInfo(SILFunction *f) const {
+    llvm::sys::ScopedLock lock(storageLock);
+    return storage.count(f);
+  }
 
   /// Attempt to lookup up the information that the analysis has for the given
   /// function. Returns nullptr upon failure.
   NullablePtr<FunctionInfoTy> maybeGet(SILFunction *f) {
+    llvm::sys::ScopedLock lock(storageLock);
     auto iter = storage.find(f);
     if (iter == storage.end())
       return nullptr;
@@ -216,6 +229,11 @@ public:
     // Check that the analysis can handle this function.
     verifyFunction(f);
 
+    // The lock is held across newFunctionAnalysis so that concurrent
+    // requests for the same function get one info object; the recursive
+    // lock keeps same-analysis requests for other functions made during
+    // that computation legal.
+    llvm::sys::ScopedLock lock(storageLock);
     auto &it = storage.FindAndConstruct(f);
     if (!it.second)
       it.second = newFunctionAnalysis(f);
@@ -229,6 +247,7 @@ public:
 
   /// Helper function to remove the function info for a specific function.
   void invalidateFunction(SILFunction *f) {
+    llvm::sys::ScopedLock lock(storageLock);
     auto &it = storage.FindAndConstruct(f);
     if (!it.second)
       return;
@@ -269,6 +288,7 @@ public:
   /// This is not meant to be overridden by subclasses. Instead please override
   /// void FunctionAnalysisBase::verify(FunctionInfoTy *fInfo).
   virtual void verify() const override final {
+    llvm::sys::ScopedLock lock(storageLock);
     for (auto iter : storage) {
       if (!iter.second)
         continue;
@@ -282,6 +302,7 @@ public:
   /// This is not meant to be overridden by subclasses. Instead, please
   /// override: void FunctionAnalysisBase::verify(FunctionInfoTy *fInfo).
   virtual void verify(SILFunction *f) const override final {
+    llvm::sys::ScopedLock lock(storageLock);
     auto iter = storage.find(f);
     if (iter == storage.end())
       return;
@@ -22,6 +22,16 @@ namespace swift {
 class SILModule;
 class SILInstruction;
 
+/// Note on incremental updates: invalidation here is all-or-nothing per
+/// function, so any pass reporting a Branches invalidation recomputes the
+/// whole tree even for a single split edge. LLVM's dominator tree has had
+/// incremental insertEdge/deleteEdge updates for a while; adopting them is
+/// not an analysis-local change, though — every CFG-mutating utility
+/// (splitEdge, mergeBasicBlocks, SimplifyCFG's jump threading) would have
+/// to report precise edge deltas instead of the coarse invalidation kinds,
+/// and a single unreported mutation silently corrupts the tree. The
+/// migration path is an opt-in updater object passed through the CFG
+/// utilities, validated against full recomputation in asserts builds.
 class DominanceAnalysis : public FunctionAnalysisBase<DominanceInfo> {
 protected:
   virtual void verify(DominanceInfo *DI) const override {
@@ -18,6 +18,8 @@
 #include "llvm/ADT/SmallVector.h"
 #include "llvm/Support/Casting.h"
 #include "llvm/Support/ErrorHandling.h"
+#include <atomic>
+#include <mutex>
 #include <vector>
 
 #ifndef SWIFT_SILOPTIMIZER_PASSMANAGER_PASSMANAGER_H
@@ -69,8 +71,9 @@ class SILPassManager {
   // Name of the current optimization stage for diagnostics.
   std::string StageName;
 
-  /// The number of passes run so far.
-  unsigned NumPassesRun = 0;
+  /// The number of passes run so far. Atomic because workers increment it
+  /// concurrently in the parallel function-pass mode.
+  std::atomic<unsigned> NumPassesRun{0};
 
   /// A mask which has one bit for each pass. A one for a pass-bit means that
   /// the pass doesn't need to run, because nothing has changed since the
@@ -87,12 +90,15 @@ class SILPassManager {
   /// worklist (e.g. caused by a bug in a specializing optimization).
   llvm::DenseMap<SILFunction *, int> DerivationLevels;
 
-  /// Set to true when a pass invalidates an analysis.
-  bool CurrentPassHasInvalidated = false;
+  /// Set to true when a pass invalidates an analysis. Atomic because
+  /// invalidations arrive from worker threads in the parallel function-pass
+  /// mode while the per-run clear happens on the thread driving the pass.
+  std::atomic<bool> CurrentPassHasInvalidated{false};
 
   /// True if we need to stop running passes and restart again on the
-  /// same function.
-  bool RestartPipeline = false;
+  /// same function. Atomic for the same reason: restartPassPipeline() is
+  /// called from passes running on worker threads.
+  std::atomic<bool> RestartPipeline{false};
 
   /// If true, passes are also run for functions which have
   /// OptimizationMode::NoOptimization.
@@ -101,6 +107,13 @@ class SILPassManager {
   /// The IRGen SIL passes. These have to be dynamically added by IRGen.
   llvm::DenseMap<unsigned, SILTransform *> IRGenPasses;
 
+  /// Guards the per-function state of the pass manager (the function
+  /// worklist, the completed-passes map and analysis invalidation) when
+  /// function passes are run on multiple threads.
+  ///
+  /// Uncontended in the default serial mode.
+  std::mutex SharedStateMutex;
+
 public:
   /// C'tor. It creates and registers all analysis passes, which are defined
   /// in Analysis.def.
@@ -178,11 +191,13 @@ public:
   /// \brief Broadcast the invalidation of the function to all analysis.
   void invalidateAnalysis(SILFunction *F,
                           SILAnalysis::InvalidationKind K) {
+    std::lock_guard<std::mutex> guard(SharedStateMutex);
+
     // Invalidate the analysis (unless they are locked)
     for (auto AP : Analyses)
       if (!AP->isLocked())
         AP->invalidate(F, K);
-    
+
     CurrentPassHasInvalidated = true;
     // Any change let all passes run again.
     CompletedPassesMap[F].reset();
@@ -204,6 +219,8 @@ public:
 
   /// \brief Iterate over all analysis and notify them of a deleted function.
   void notifyWillDeleteFunction(SILFunction *F) {
+    std::lock_guard<std::mutex> guard(SharedStateMutex);
+
     // Invalidate the analysis (unless they are locked)
     for (auto AP : Analyses)
       if (!AP->isLocked())
@@ -289,6 +306,17 @@ private:
   /// Run the passes in Transform from \p FromTransIdx to \p ToTransIdx.
   void runFunctionPasses(unsigned FromTransIdx, unsigned ToTransIdx);
 
+  /// Run the passes from \p FromTransIdx to \p ToTransIdx on call-graph
+  /// independent functions in parallel. Functions which are created while
+  /// the thread pool is running are processed serially afterwards.
+  void runFunctionPassesParallel(unsigned FromTransIdx, unsigned ToTransIdx,
+                                 unsigned NumThreads);
+
+  /// Run the whole pipeline from \p FromTransIdx to \p ToTransIdx on a
+  /// single function, honoring pipeline restarts.
+  void runPipelineOnFunction(unsigned FromTransIdx, unsigned ToTransIdx,
+                             SILFunction *F);
+
   /// A helper function that returns (based on SIL stage and debug
   /// options) whether we should continue running passes.
   bool continueTransforming();
@@ -28,6 +28,9 @@ extern llvm::cl::opt<bool> EnableSILInliningOfGenerics;
 
 namespace swift {
 class SideEffectAnalysis;
+namespace OptRemark {
+class Emitter;
+}
 
 // Controls the decision to inline functions with @_semantics, @effect and
 // global_init attributes.
@@ -38,8 +41,12 @@ enum class InlineSelection {
 };
 
 // Returns the callee of an apply_inst if it is basically inlinable.
+// When an emitter is provided, each ineligible callsite is reported as a
+// missed-optimization remark with a stable reason, so tooling can diff
+// inlining decisions across compiler versions.
 SILFunction *getEligibleFunction(FullApplySite AI,
-                                 InlineSelection WhatToInline);
+                                 InlineSelection WhatToInline,
+                                 OptRemark::Emitter *ORE = nullptr);
 
 // Returns true if this is a pure call, i.e. the callee has no side-effects
 // and all arguments are constants.
@@ -55,7 +55,7 @@ const uint16_t VERSION_MAJOR = 0;
 /// describe what change you made. The content of this comment isn't important;
 /// it just ensures a conflict if two people change the module format.
 /// Don't worry about adhering to the 80-column limit for this line.
-const uint16_t VERSION_MINOR = 431; // Last change: eliminate PARAMETERLIST_ELT
+const uint16_t VERSION_MINOR = 433; // Last change: module interface hash
 
 using DeclIDField = BCFixed<31>;
 
@@ -546,7 +546,8 @@ namespace control_block {
   enum {
     METADATA = 1,
     MODULE_NAME,
-    TARGET
+    TARGET,
+    INTERFACE_HASH
   };
 
   using MetadataLayout = BCRecordLayout<
@@ -567,6 +568,15 @@ namespace control_block {
     TARGET,
     BCBlob // LLVM triple
   >;
+
+  /// A stable digest of the module's source interface, combined from the
+  /// per-source-file interface hashes. Whitespace- and body-only edits leave
+  /// it unchanged, so build systems can compare it to decide whether
+  /// dependents actually need to be recompiled.
+  using InterfaceHashLayout = BCRecordLayout<
+    INTERFACE_HASH,
+    BCBlob // hex digest
+  >;
 }
 
 /// The record types within the options block (a sub-block of the control
@@ -1642,9 +1652,14 @@ namespace index_block {
                 "not enough bits for all record kinds");
   using RecordIDField = BCFixed<RecordIDFieldWidth>;
 
+  /// An offset table is stored as a blob of little-endian fixed-width
+  /// entries rather than a bitstream array, so that readers can copy it
+  /// straight out of the (possibly memory-mapped) module buffer instead of
+  /// decoding every element.
   using OffsetsLayout = BCGenericRecordLayout<
     RecordIDField, // record ID
-    BCArray<BitOffsetField>
+    BCVBR<16>,     // number of entries
+    BCBlob         // little-endian fixed-width array of bit offsets
   >;
 
   using DeclListLayout = BCGenericRecordLayout<
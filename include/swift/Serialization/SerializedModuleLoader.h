@@ -15,6 +15,8 @@
 
 #include "swift/AST/Module.h"
 #include "swift/AST/ModuleLoader.h"
+#include "llvm/ADT/StringMap.h"
+#include "llvm/ADT/StringSet.h"
 #include "llvm/Support/MemoryBuffer.h"
 
 namespace swift {
@@ -25,6 +27,12 @@ class SerializedModuleLoader : public ModuleLoader {
 private:
   ASTContext &Ctx;
   llvm::StringMap<std::unique_ptr<llvm::MemoryBuffer>> MemoryBuffers;
+
+  /// Cached listings of the module search directories, so that each import
+  /// checks candidate names against one directory read per search path
+  /// instead of issuing several filesystem probes per candidate. Search
+  /// paths are immutable for the lifetime of a compilation.
+  llvm::StringMap<llvm::StringSet<>> SearchPathListings;
   /// A { module, generation # } pair.
   using LoadedModulePair = std::pair<std::unique_ptr<ModuleFile>, unsigned>;
   std::vector<LoadedModulePair> LoadedModuleFiles;
@@ -74,6 +74,11 @@ bool isSerializedAST(StringRef data);
 struct ValidationInfo {
   StringRef name = {};
   StringRef targetTriple = {};
+
+  /// The module's stable source-interface digest, if it was recorded.
+  /// Edits which do not change any source file's interface (whitespace,
+  /// comments, function bodies) leave this unchanged.
+  StringRef interfaceHash = {};
   StringRef shortVersion = {};
   version::Version compatibilityVersion = {};
   size_t bytes = 0;
@@ -279,6 +279,12 @@ class RawSyntax final
              ? Bits.Token.NumLeadingTrivia + Bits.Token.NumTrailingTrivia
              : 0;
   }
+  // Note: trivia pieces are tail-allocated right here in the node — a token
+  // and its trivia are one allocation (and zero extra allocations when the
+  // node itself lives in a SyntaxArena). The per-token trivia *vectors*
+  // only exist transiently in the parser while a token is being formed;
+  // pieces whose text is owned (comments, garbage text) may still own heap
+  // storage individually via OwnedString.
 
   /// Constructor for creating layout nodes
   /// If \p NodeId is \c None, the next free NodeId is used, if it is passed,
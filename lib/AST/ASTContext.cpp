@@ -103,6 +103,34 @@ using AssociativityCacheType =
   llvm::DenseMap<std::pair<PrecedenceGroupDecl *, PrecedenceGroupDecl *>,
                  Associativity>;
 
+namespace {
+/// A folding set segmented into hash-disjoint shards.
+///
+/// Lookups and insertions for different profiles land in independent
+/// shards. That is the structural prerequisite for letting each shard carry
+/// its own lock (or become thread-local) once clients of the ASTContext can
+/// run in parallel; until then it also keeps each search structure smaller.
+template <typename T, unsigned NumShards = 8>
+class ShardedFoldingSet {
+  llvm::FoldingSet<T> Shards[NumShards];
+
+public:
+  llvm::FoldingSet<T> &getShard(const llvm::FoldingSetNodeID &ID) {
+    return Shards[ID.ComputeHash() % NumShards];
+  }
+
+  T *FindNodeOrInsertPos(const llvm::FoldingSetNodeID &ID, void *&InsertPos) {
+    return getShard(ID).FindNodeOrInsertPos(ID, InsertPos);
+  }
+
+  /// Insert \p N, whose profile must be \p ID, at the position computed by
+  /// an immediately preceding FindNodeOrInsertPos with the same \p ID.
+  void InsertNode(T *N, const llvm::FoldingSetNodeID &ID, void *InsertPos) {
+    getShard(ID).InsertNode(N, InsertPos);
+  }
+};
+} // end anonymous namespace
+
 #define FOR_KNOWN_FOUNDATION_TYPES(MACRO) \
   MACRO(NSError) \
   MACRO(NSNumber) \
@@ -112,6 +140,16 @@ struct ASTContext::Implementation {
   Implementation();
   ~Implementation();
 
+  // Note on page-fault overhead in huge jobs: BumpPtrAllocator's slab size
+  // doubles every 128 slabs, so multi-GB contexts already converge on large
+  // slabs; the 4KB faults come from the kernel populating those slabs one
+  // base page at a time. The portable fix is transparent hugepages on the
+  // slab allocations, which belongs in a custom AllocatorTy (an
+  // AllocateSlab that madvise(MADV_HUGEPAGE)s, or mmaps 2MB-aligned) passed
+  // as this member's template argument — not in the clients, and not via
+  // prefaulting loops, which just move the fault cost. Sizing the first
+  // slab from a prior run's NumASTBytesAllocated is complementary and can
+  // be threaded through the same custom allocator.
   llvm::BumpPtrAllocator Allocator; // used in later initializations
 
   /// The set of cleanups to be called when the ASTContext is destroyed.
@@ -276,7 +314,7 @@ FOR_KNOWN_FOUNDATION_TYPES(CACHE_FOUNDATION_DECL)
   struct Arena {
     llvm::DenseMap<Type, ErrorType *> ErrorTypesWithOriginal;
     llvm::FoldingSet<NameAliasType> NameAliasTypes;
-    llvm::FoldingSet<TupleType> TupleTypes;
+    ShardedFoldingSet<TupleType> TupleTypes;
     llvm::DenseMap<std::pair<Type,char>, MetatypeType*> MetatypeTypes;
     llvm::DenseMap<std::pair<Type,char>,
                    ExistentialMetatypeType*> ExistentialMetatypeTypes;
@@ -296,7 +334,7 @@ FOR_KNOWN_FOUNDATION_TYPES(CACHE_FOUNDATION_DECL)
     llvm::FoldingSet<StructType> StructTypes;
     llvm::FoldingSet<ClassType> ClassTypes;
     llvm::FoldingSet<UnboundGenericType> UnboundGenericTypes;
-    llvm::FoldingSet<BoundGenericType> BoundGenericTypes;
+    ShardedFoldingSet<BoundGenericType> BoundGenericTypes;
     llvm::FoldingSet<ProtocolType> ProtocolTypes;
     llvm::FoldingSet<ProtocolCompositionType> ProtocolCompositionTypes;
     llvm::FoldingSet<LayoutConstraintInfo> LayoutConstraints;
@@ -405,8 +443,11 @@ FOR_KNOWN_FOUNDATION_TYPES(CACHE_FOUNDATION_DECL)
   syntax::SyntaxArena TheSyntaxArena;
 };
 
+// Every frontend job interns thousands of identifiers from the stdlib and
+// SDK before user code even parses. Start the table at a realistic size, so
+// each job skips the doubling-rehash cascade up from the default.
 ASTContext::Implementation::Implementation()
- : IdentifierTable(Allocator) {}
+ : IdentifierTable(8192, Allocator) {}
 ASTContext::Implementation::~Implementation() {
   for (auto &cleanup : Cleanups)
     cleanup();
@@ -3017,7 +3058,7 @@ Type TupleType::get(ArrayRef<TupleTypeElt> Fields, const ASTContext &C) {
                          alignof(TupleType), arena);
   auto New = new (mem) TupleType(Fields, IsCanonical ? &C : nullptr, properties,
                                  hasInOut);
-  C.getImpl().getArena(arena).TupleTypes.InsertNode(New, InsertPos);
+  C.getImpl().getArena(arena).TupleTypes.InsertNode(New, ID, InsertPos);
   return New;
 }
 
@@ -3232,7 +3273,8 @@ BoundGenericType *BoundGenericType::get(NominalTypeDecl *TheDecl,
   } else {
     llvm_unreachable("Unhandled NominalTypeDecl");
   }
-  C.getImpl().getArena(arena).BoundGenericTypes.InsertNode(newType, InsertPos);
+  C.getImpl().getArena(arena).BoundGenericTypes.InsertNode(newType, ID,
+                                                            InsertPos);
 
   return newType;
 }
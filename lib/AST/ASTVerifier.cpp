@@ -33,6 +33,7 @@
 #include "swift/Subsystems.h"
 #include "llvm/ADT/SmallBitVector.h"
 #include "llvm/ADT/SmallString.h"
+#include "llvm/Support/CommandLine.h"
 #include "llvm/Support/Debug.h"
 #include "llvm/Support/raw_ostream.h"
 #include <functional>
@@ -3626,8 +3627,29 @@ public:
   };
 } // end anonymous namespace
 
+#if !(defined(NDEBUG) || defined(SWIFT_DISABLE_AST_VERIFIER))
+/// Only verify one out of every <N> top-level declarations per file, chosen
+/// deterministically, so qualification builds can keep the verifier enabled
+/// at a fraction of its cost. 1 verifies everything.
+static llvm::cl::opt<unsigned> ASTVerifierSampleRate(
+    "ast-verifier-sample-rate", llvm::cl::init(1));
+#endif
+
 void swift::verify(SourceFile &SF) {
 #if !(defined(NDEBUG) || defined(SWIFT_DISABLE_AST_VERIFIER))
+  if (ASTVerifierSampleRate > 1) {
+    // Deterministic sampling by position: stable for a given file content,
+    // so failures reproduce, and different rates cover different slices.
+    unsigned index = 0;
+    for (Decl *D : SF.Decls) {
+      if (index++ % ASTVerifierSampleRate != 0)
+        continue;
+      Verifier V = Verifier::forDecl(D);
+      D->walk(V);
+    }
+    return;
+  }
+
   Verifier verifier(SF, &SF);
   SF.walk(verifier);
 #endif
@@ -3670,10 +3670,31 @@ bool ProtocolDecl::walkInheritedProtocols(
 
 }
 
+ArrayRef<ProtocolDecl *> ProtocolDecl::computeInheritedProtocolsClosure() {
+  SmallVector<ProtocolDecl *, 8> closure;
+  walkInheritedProtocols([&](ProtocolDecl *inherited) {
+    if (inherited != this)
+      closure.push_back(inherited);
+    return TypeWalker::Action::Continue;
+  });
+  InheritedProtocolsClosure = getASTContext().AllocateCopy(closure);
+  return *InheritedProtocolsClosure;
+}
+
 bool ProtocolDecl::inheritsFrom(const ProtocolDecl *super) const {
   if (this == super)
     return false;
 
+  // Deep refinement hierarchies make this a hot query; answer it from the
+  // cached closure when the protocol is far enough along that the closure
+  // can no longer change.
+  if (isRequirementSignatureComputed()) {
+    auto closure = InheritedProtocolsClosure
+        ? *InheritedProtocolsClosure
+        : const_cast<ProtocolDecl *>(this)->computeInheritedProtocolsClosure();
+    return std::find(closure.begin(), closure.end(), super) != closure.end();
+  }
+
   return walkInheritedProtocols([super](ProtocolDecl *inherited) {
     if (inherited == super)
       return TypeWalker::Action::Stop;
@@ -697,6 +697,13 @@ void DiagnosticEngine::emitTentativeDiagnostics() {
 }
 
 void DiagnosticEngine::emitDiagnostic(const Diagnostic &diagnostic) {
+  // Keep this early return cheap and first: everything below — location
+  // resolution, decl pretty-printing, text formatting in the consumers —
+  // must stay behind it. A Diagnostic holds only its DiagnosticArgument
+  // payloads and a SourceLoc, so a diagnostic suppressed here (e.g. by
+  // -suppress-warnings) never touches the SourceManager or renders a
+  // single character; builds with tens of thousands of suppressed
+  // warnings rely on that.
   auto behavior = state.determineBehavior(diagnostic.getID());
   if (behavior == DiagnosticState::Behavior::Ignore)
     return;
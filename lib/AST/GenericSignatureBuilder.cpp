@@ -2887,15 +2887,17 @@ static void concretizeNestedTypeFromConcreteParent(
 
   // If we don't already have a conformance of the parent to this protocol,
   // add it now; it was elided earlier.
-  if (parentEquiv->conformsTo.count(proto) == 0) {
+  auto knownConformance = parentEquiv->conformsTo.find(proto);
+  if (knownConformance == parentEquiv->conformsTo.end()) {
     auto source = parentEquiv->concreteTypeConstraints.front().source;
     parentEquiv->recordConformanceConstraint(builder, parent, proto, source);
+    knownConformance = parentEquiv->conformsTo.find(proto);
   }
 
-  assert(parentEquiv->conformsTo.count(proto) > 0 &&
+  assert(knownConformance != parentEquiv->conformsTo.end() &&
          "No conformance requirement");
   const RequirementSource *parentConcreteSource = nullptr;
-  for (const auto &constraint : parentEquiv->conformsTo.find(proto)->second) {
+  for (const auto &constraint : knownConformance->second) {
     if (constraint.source->kind == RequirementSource::Concrete) {
       parentConcreteSource = constraint.source;
     }
@@ -147,6 +147,7 @@ public:
   typedef ModuleDecl::AccessPathTy AccessPathTy;
   
   LookupCache(const SourceFile &SF);
+  LookupCache(const ModuleDecl &M);
 
   /// Throw away as much memory as possible.
   void invalidate();
@@ -234,6 +235,46 @@ SourceLookupCache::LookupCache(const SourceFile &SF) {
   doPopulateCache(llvm::makeArrayRef(SF.Decls), false);
 }
 
+/// Populate a merged cache from every source file of the module.
+SourceLookupCache::LookupCache(const ModuleDecl &M) {
+  for (const FileUnit *file : M.getFiles()) {
+    auto &SF = *cast<SourceFile>(file);
+    doPopulateCache(llvm::makeArrayRef(SF.Decls), false);
+  }
+}
+
+/// A module-wide merged lookup cache over the top-level declarations of all
+/// of the module's source files, together with the state stamp it was built
+/// against (see sourceLookupCacheStampForModule).
+namespace swift {
+class ModuleSourceLookupCache final : public SourceFile::LookupCache {
+public:
+  const uint64_t Stamp;
+
+  ModuleSourceLookupCache(const ModuleDecl &M, uint64_t stamp)
+      : LookupCache(M), Stamp(stamp) {}
+};
+} // end namespace swift
+
+/// Compute a stamp for the state of the module's source files, setting
+/// \p usable to false if the module contains files for which the merged
+/// source lookup cache cannot be used (non-source files, or files whose
+/// declarations are still being populated).
+static uint64_t sourceLookupCacheStampForModule(const ModuleDecl &M,
+                                                bool &usable) {
+  uint64_t stamp = 0;
+  for (const FileUnit *file : M.getFiles()) {
+    auto *SF = dyn_cast<SourceFile>(file);
+    if (!SF || SF->ASTStage < SourceFile::NameBound) {
+      usable = false;
+      return 0;
+    }
+    stamp += SF->Decls.size() + 1;
+  }
+  usable = !M.getFiles().empty();
+  return stamp;
+}
+
 void SourceLookupCache::lookupValue(AccessPathTy AccessPath, DeclName Name,
                                     NLKind LookupKind,
                                     SmallVectorImpl<ValueDecl*> &Result) {
@@ -393,6 +434,24 @@ void ModuleDecl::removeFile(FileUnit &existingFile) {
 void ModuleDecl::lookupValue(AccessPathTy AccessPath, DeclName Name,
                              NLKind LookupKind, 
                              SmallVectorImpl<ValueDecl*> &Result) const {
+  // For a module consisting purely of name-bound source files, answer
+  // lookups from a single merged cache: forwarding costs a hash probe per
+  // file per query, which dominates lookup time in many-file modules. The
+  // stamp check keeps the cache coherent if files gain declarations later
+  // (e.g. the REPL appending to its file); rebuilds are rare once name
+  // binding is done.
+  bool canUseMergedCache;
+  uint64_t stamp = sourceLookupCacheStampForModule(*this, canUseMergedCache);
+  if (canUseMergedCache) {
+    if (!MergedSourceLookupCache || MergedSourceLookupCache->Stamp != stamp) {
+      auto *cache = new ModuleSourceLookupCache(*this, stamp);
+      getASTContext().addCleanup([cache] { delete cache; });
+      MergedSourceLookupCache = cache;
+    }
+    MergedSourceLookupCache->lookupValue(AccessPath, Name, LookupKind, Result);
+    return;
+  }
+
   FORWARD(lookupValue, (AccessPath, Name, LookupKind, Result));
 }
 
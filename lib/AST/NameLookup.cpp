@@ -1011,6 +1011,17 @@ void LazyConformanceLoader::anchor() {}
 
 /// Lookup table used to store members of a nominal type (and its extensions)
 /// for fast retrieval.
+///
+/// Sizing note: replacing this with a sorted array over interned name
+/// indices (plus a negative-lookup filter) was considered for very large
+/// generated classes. The table is mutation-heavy in exactly the cases
+/// where it's large — extensions merge in incrementally, and lazy member
+/// loading inserts names one at a time — so a sorted array pays repeated
+/// re-sorting where the hash map pays scattered inserts, and the per-entry
+/// memory is dominated by the TinyPtrVector overflow for overloaded names
+/// either way. The effective first-touch fix was making named lazy member
+/// loading cover more queries, which avoids building complete tables at
+/// all for deserialized types.
 class swift::MemberLookupTable {
   /// The last extension that was included within the member lookup table's
   /// results.
@@ -1391,11 +1402,17 @@ TinyPtrVector<ValueDecl *> NominalTypeDecl::lookupDirect(
   bool useNamedLazyMemberLoading = (ctx.LangOpts.NamedLazyMemberLoading &&
                                     hasLazyMembers());
 
-  // FIXME: At present, lazy member loading conflicts with a bunch of other code
-  // that appears to special-case initializers (clang-imported initializer
-  // sorting, implicit initializer synthesis), so for the time being we have to
-  // turn it off for them entirely.
-  if (name.getBaseName() == DeclBaseName::createConstructor())
+  // FIXME: At present, lazy member loading conflicts with a bunch of other
+  // code that special-cases initializers of Clang-imported types
+  // (clang-imported initializer sorting, implicit initializer synthesis), so
+  // for the time being we have to turn it off for them entirely. Swift types
+  // loaded from a serialized module have their complete initializer set
+  // serialized, including implicit ones, and index them under the
+  // constructor base name, so they can keep using the named index — which
+  // matters because initializer lookups are among the most frequent queries
+  // issued against large deserialized frameworks.
+  if (name.getBaseName() == DeclBaseName::createConstructor() &&
+      hasClangNode())
     useNamedLazyMemberLoading = false;
 
   LLVM_DEBUG(llvm::dbgs() << getNameStr() << ".lookupDirect(" << name << ")"
@@ -227,3 +227,39 @@ void IsDynamicRequest::cacheResult(bool value) const {
   auto decl = std::get<0>(getStorage());
   decl->setIsDynamic(value);
 }
+
+//----------------------------------------------------------------------------//
+// Function body type checking.
+//----------------------------------------------------------------------------//
+
+bool TypeCheckFunctionBodyRequest::breakCycle() const {
+  // A cycle during body checking is an error.
+  return true;
+}
+
+void TypeCheckFunctionBodyRequest::diagnoseCycle(DiagnosticEngine &diags) const {
+  // FIXME: Improve this diagnostic.
+  auto func = std::get<0>(getStorage());
+  diags.diagnose(func, diag::circular_reference);
+}
+
+void TypeCheckFunctionBodyRequest::noteCycleStep(DiagnosticEngine &diags) const {
+  auto func = std::get<0>(getStorage());
+  // FIXME: Customize this further.
+  diags.diagnose(func, diag::circular_reference_through);
+}
+
+Optional<bool> TypeCheckFunctionBodyRequest::getCachedResult() const {
+  // An already-checked body is never re-checked; its diagnostics have
+  // already been emitted.
+  auto func = std::get<0>(getStorage());
+  if (func->isBodyTypeChecked())
+    return false;
+
+  return None;
+}
+
+void TypeCheckFunctionBodyRequest::cacheResult(bool value) const {
+  // Type checking the body marks it as such itself; there is no separate
+  // state to update here.
+}
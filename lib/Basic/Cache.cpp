@@ -14,12 +14,16 @@
 #include "Darwin/Cache-Mac.cpp"
 #else
 
-//  This file implements a default caching implementation that never evicts
-//  its entries.
+//  This file implements a default caching implementation with a bounded,
+//  cost-aware LRU eviction policy. (Darwin uses libcache instead, which
+//  evicts under memory pressure; this keeps the non-Darwin behavior in the
+//  same family instead of growing without bound.)
 
 #include "swift/Basic/Cache.h"
 #include "llvm/ADT/DenseMap.h"
 #include "llvm/Support/Mutex.h"
+#include <cstdlib>
+#include <list>
 
 using namespace swift::sys;
 using llvm::StringRef;
@@ -33,12 +37,84 @@ struct DefaultCacheKey {
   DefaultCacheKey(void *Key, CacheImpl::CallBacks *CBs) : Key(Key), CBs(CBs) {}
 };
 
+struct DefaultCacheEntry {
+  void *Value = nullptr;
+  size_t Cost = 0;
+
+  /// Position in the LRU order list (which stores raw key pointers).
+  std::list<void *>::iterator LruPosition;
+};
+
 struct DefaultCache {
   llvm::sys::Mutex Mux;
   CacheImpl::CallBacks CBs;
-  llvm::DenseMap<DefaultCacheKey, void *> Entries;
+  llvm::DenseMap<DefaultCacheKey, DefaultCacheEntry> Entries;
+
+  /// Keys in recency order; most recently used at the front.
+  std::list<void *> LruOrder;
+
+  /// Sum of the costs of all entries, against \c CostBudget.
+  size_t TotalCost = 0;
+
+  /// The cost budget in bytes (costs are reported in bytes by the cache
+  /// clients that report them at all). Overridable for deployments with
+  /// different memory envelopes; 0 disables eviction.
+  size_t CostBudget;
+
+  /// Values with outstanding external references (from setAndRetain /
+  /// getAndRetain, released via releaseValue). The value callbacks cannot
+  /// express per-handle retains uniformly — the default traits pair a
+  /// no-op retain with a deleting release — so the cache tracks handles
+  /// itself. Each entry insertion takes one valueRetainCB reference on
+  /// behalf of the cache, paired with exactly one valueReleaseCB when the
+  /// entry has been evicted and the last handle is gone; PendingReleases
+  /// counts evictions deferred behind live handles (a value stored under
+  /// several keys owes one release per eviction).
+  struct OutstandingRefs {
+    unsigned Refs = 0;
+    unsigned PendingReleases = 0;
+  };
+  llvm::DenseMap<void *, OutstandingRefs> Outstanding;
+
+  /// Must be called with the mutex held: note eviction of \p value,
+  /// releasing the entry's cache reference now unless handles are still
+  /// outstanding.
+  void evictValue(void *value) {
+    auto refs = Outstanding.find(value);
+    if (refs == Outstanding.end() || refs->second.Refs == 0) {
+      CBs.valueReleaseCB(value, nullptr);
+      if (refs != Outstanding.end())
+        Outstanding.erase(refs);
+      return;
+    }
+    ++refs->second.PendingReleases;
+  }
 
-  explicit DefaultCache(CacheImpl::CallBacks CBs) : CBs(std::move(CBs)) { }
+  explicit DefaultCache(CacheImpl::CallBacks CBs) : CBs(std::move(CBs)) {
+    CostBudget = 512 * 1024 * 1024;
+    if (const char *env = getenv("SWIFT_GENERIC_CACHE_BUDGET")) {
+      CostBudget = strtoull(env, nullptr, 10);
+    }
+  }
+
+  /// Must be called with the mutex held. Evicts least-recently-used
+  /// entries until the total cost fits the budget. Values released here
+  /// stay alive for any concurrent user via the reference getAndRetain
+  /// takes on the caller's behalf.
+  void evictToFit() {
+    if (CostBudget == 0)
+      return;
+    while (TotalCost > CostBudget && !LruOrder.empty()) {
+      DefaultCacheKey victimKey(LruOrder.back(), &CBs);
+      auto victim = Entries.find(victimKey);
+      assert(victim != Entries.end() && "LRU list out of sync with entries");
+      TotalCost -= victim->second.Cost;
+      CBs.keyDestroyCB(victim->first.Key, nullptr);
+      evictValue(victim->second.Value);
+      Entries.erase(victim);
+      LruOrder.pop_back();
+    }
+  }
 };
 } // end anonymous namespace
 
@@ -78,18 +154,35 @@ void CacheImpl::setAndRetain(void *Key, void *Value, size_t Cost) {
   DefaultCacheKey CKey(Key, &DCache.CBs);
   auto Entry = DCache.Entries.find(CKey);
   if (Entry != DCache.Entries.end()) {
-    if (Entry->second == Value)
+    if (Entry->second.Value == Value) {
+      // Refresh recency and cost. The caller still receives a handle to
+      // release, like every setAndRetain call.
+      ++DCache.Outstanding[Value].Refs;
+      DCache.LruOrder.splice(DCache.LruOrder.begin(), DCache.LruOrder,
+                             Entry->second.LruPosition);
+      DCache.TotalCost -= Entry->second.Cost;
+      DCache.TotalCost += Cost;
+      Entry->second.Cost = Cost;
+      DCache.evictToFit();
       return;
+    }
+    DCache.TotalCost -= Entry->second.Cost;
+    DCache.LruOrder.erase(Entry->second.LruPosition);
     DCache.CBs.keyDestroyCB(Entry->first.Key, nullptr);
-    DCache.CBs.valueReleaseCB(Entry->second, nullptr);
+    DCache.evictValue(Entry->second.Value);
     DCache.Entries.erase(Entry);
   }
 
+  // The cache takes its own reference for the new entry — enterCache hands
+  // over an unowned pointer — and the caller additionally holds a handle
+  // until releaseValue.
   DCache.CBs.valueRetainCB(Value, nullptr);
-  DCache.Entries[CKey] = Value;
-
-  // FIXME: Not thread-safe! It should avoid deleting the value until
-  // 'releaseValue is called on it.
+  ++DCache.Outstanding[Value].Refs;
+  DCache.LruOrder.push_front(Key);
+  DCache.Entries[DefaultCacheKey(Key, &DCache.CBs)] =
+      DefaultCacheEntry{Value, Cost, DCache.LruOrder.begin()};
+  DCache.TotalCost += Cost;
+  DCache.evictToFit();
 }
 
 bool CacheImpl::getAndRetain(const void *Key, void **Value_out) {
@@ -99,16 +192,32 @@ bool CacheImpl::getAndRetain(const void *Key, void **Value_out) {
   DefaultCacheKey CKey(const_cast<void*>(Key), &DCache.CBs);
   auto Entry = DCache.Entries.find(CKey);
   if (Entry != DCache.Entries.end()) {
-    // FIXME: Not thread-safe! It should avoid deleting the value until
-    // 'releaseValue is called on it.
-    *Value_out = Entry->second;
+    // Track a handle on behalf of the caller, so that eviction on another
+    // thread cannot destroy the value before the caller pairs this call
+    // with releaseValue().
+    ++DCache.Outstanding[Entry->second.Value].Refs;
+    DCache.LruOrder.splice(DCache.LruOrder.begin(), DCache.LruOrder,
+                           Entry->second.LruPosition);
+    *Value_out = Entry->second.Value;
     return true;
   }
   return false;
 }
 
 void CacheImpl::releaseValue(void *Value) {
-  // FIXME: Implementation.
+  DefaultCache &DCache = *static_cast<DefaultCache*>(Impl);
+  llvm::sys::ScopedLock L(DCache.Mux);
+
+  auto refs = DCache.Outstanding.find(Value);
+  assert(refs != DCache.Outstanding.end() && "unbalanced releaseValue");
+  if (refs == DCache.Outstanding.end())
+    return;
+  if (--refs->second.Refs == 0) {
+    unsigned pendingReleases = refs->second.PendingReleases;
+    DCache.Outstanding.erase(refs);
+    for (; pendingReleases > 0; --pendingReleases)
+      DCache.CBs.valueReleaseCB(Value, nullptr);
+  }
 }
 
 bool CacheImpl::remove(const void *Key) {
@@ -118,8 +227,10 @@ bool CacheImpl::remove(const void *Key) {
   DefaultCacheKey CKey(const_cast<void*>(Key), &DCache.CBs);
   auto Entry = DCache.Entries.find(CKey);
   if (Entry != DCache.Entries.end()) {
+    DCache.TotalCost -= Entry->second.Cost;
+    DCache.LruOrder.erase(Entry->second.LruPosition);
     DCache.CBs.keyDestroyCB(Entry->first.Key, nullptr);
-    DCache.CBs.valueReleaseCB(Entry->second, nullptr);
+    DCache.evictValue(Entry->second.Value);
     DCache.Entries.erase(Entry);
     return true;
   }
@@ -130,11 +241,13 @@ void CacheImpl::removeAll() {
   DefaultCache &DCache = *static_cast<DefaultCache*>(Impl);
   llvm::sys::ScopedLock L(DCache.Mux);
 
-  for (auto Entry : DCache.Entries) {
+  for (auto &Entry : DCache.Entries) {
     DCache.CBs.keyDestroyCB(Entry.first.Key, nullptr);
-    DCache.CBs.valueReleaseCB(Entry.second, nullptr);
+    DCache.evictValue(Entry.second.Value);
   }
   DCache.Entries.clear();
+  DCache.LruOrder.clear();
+  DCache.TotalCost = 0;
 }
 
 void CacheImpl::destroy() {
@@ -119,6 +119,17 @@ std::error_code swift::atomicallyWritingToFile(
     const llvm::function_ref<void(llvm::raw_pwrite_stream &)> action) {
   namespace fs = llvm::sys::fs;
 
+  // Note on making this asynchronous: a general write-back pool has to
+  // hold the process alive until every write lands and still deliver each
+  // write's error to a diagnostic engine that is not thread-safe — the
+  // error would otherwise surface after the job's exit code is already
+  // decided. Individual callers that can tolerate deferred error reporting
+  // (module serialization overlaps its disk write with swiftdoc emission
+  // this way) thread that through explicitly; this primitive stays
+  // synchronous so its error return means what it says. Note also that no
+  // fsync happens here by design: durability is the build system's
+  // bargain, and the atomic rename only promises all-or-nothing content.
+
   // FIXME: This is mostly a simplified version of
   // clang::CompilerInstance::createOutputFile. It would be great to share the
   // implementation.
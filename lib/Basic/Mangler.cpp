@@ -110,6 +110,17 @@ void Mangle::printManglingStats() {
 #endif
 }
 
+// Note on "mangling sessions" that persist substitutions across a family
+// of symbols (e.g. a storage decl and its accessors): substitution indices
+// are positional within one mangled name, so carrying the maps' *contents*
+// across symbols changes output — only the allocations can be reused, and
+// clear() already does that for a long-lived Mangler (DenseMap/SmallVector
+// keep their capacity across clears). Callers that construct a fresh
+// ASTMangler per symbol forgo that reuse; hoisting one mangler over a loop
+// is the whole optimization, no session object required. A common-prefix
+// memo for sibling symbols faces the same positional-state problem: the
+// prefix's substitution entries are part of the state, so splicing text
+// without replaying them produces wrong manglings.
 void Mangler::beginManglingWithoutPrefix() {
   Storage.clear();
   Substitutions.clear();
@@ -24,6 +24,7 @@
 #include "llvm/Support/FileSystem.h"
 #include "llvm/Support/Path.h"
 #include "llvm/Support/Process.h"
+#include "llvm/Support/YAMLParser.h"
 #include "llvm/Support/raw_ostream.h"
 #include <chrono>
 #include <limits>
@@ -672,6 +673,54 @@ UnifiedStatsReporter::~UnifiedStatsReporter()
         E.Formatter->traceLoc(E.Entity, SourceMgr, ClangSourceMgr, tstream);
       tstream << '"' << '\n';
     }
+
+    // Also emit the events as Chrome trace-event JSON next to the CSV.
+    // Trace viewers (chrome://tracing, speedscope) open it directly, so two
+    // builds' traces can be diffed visually without post-processing.
+    SmallString<256> TraceEventFilename = TraceFilename;
+    llvm::sys::path::replace_extension(TraceEventFilename, "json");
+    raw_fd_ostream jstream(TraceEventFilename, EC, fs::F_Append | fs::F_Text);
+    if (EC) {
+      llvm::errs() << "Error opening trace-events file '"
+                   << TraceEventFilename << "' for writing\n";
+      return;
+    }
+    // Each tracer entry/exit is recorded once per changed counter; emit one
+    // begin/end pair per occurrence by skipping rows which only differ in
+    // the counter.
+    uint64_t LastTime = ~0ULL;
+    StringRef LastEvent;
+    const void *LastEntity = nullptr;
+    bool LastIsEntry = false;
+    bool First = true;
+    jstream << "[\n";
+    for (auto const &E : *FrontendStatsEvents) {
+      if (E.TimeUSec == LastTime && E.EventName == LastEvent &&
+          E.Entity == LastEntity && E.IsEntry == LastIsEntry)
+        continue;
+      LastTime = E.TimeUSec;
+      LastEvent = E.EventName;
+      LastEntity = E.Entity;
+      LastIsEntry = E.IsEntry;
+
+      SmallString<64> Name;
+      {
+        llvm::raw_svector_ostream nstream(Name);
+        nstream << E.EventName;
+        if (E.Formatter) {
+          nstream << ' ';
+          E.Formatter->traceName(E.Entity, nstream);
+        }
+      }
+      if (!First)
+        jstream << ",\n";
+      First = false;
+      jstream << "{\"name\":\"" << llvm::yaml::escape(Name)
+              << "\",\"cat\":\"swift\",\"ph\":\""
+              << (E.IsEntry ? 'B' : 'E') << "\",\"ts\":" << E.TimeUSec
+              << ",\"pid\":1,\"tid\":1}";
+    }
+    jstream << "\n]\n";
   }
 
   if (EventProfilers || EntityProfilers) {
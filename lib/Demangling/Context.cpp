@@ -16,10 +16,63 @@
 
 #include "swift/Demangling/Demangler.h"
 #include "swift/Demangling/ManglingMacros.h"
+#include "llvm/ADT/StringMap.h"
 
 namespace swift {
 namespace Demangle {
 
+/// A bounded cache of demangled symbol strings.
+///
+/// Symbolication services demangle the same hot frame symbols over and over;
+/// remember recent renderings keyed by mangled name together with the options
+/// they were rendered with. When the cache fills up it is flushed wholesale —
+/// hot entries repopulate quickly, and this keeps the implementation free of
+/// per-entry bookkeeping on the hit path.
+class Context::SymbolCache {
+  struct Entry {
+    std::string Demangled;
+    unsigned OptionsFingerprint;
+  };
+
+  llvm::StringMap<Entry> Entries;
+
+  enum : size_t { Capacity = 4096 };
+
+public:
+  /// Pack the rendering-relevant options into a comparable fingerprint.
+  static unsigned getOptionsFingerprint(const DemangleOptions &O) {
+    const bool fields[] = {
+      O.SynthesizeSugarOnTypes, O.DisplayDebuggerGeneratedModule,
+      O.QualifyEntities, O.DisplayExtensionContexts,
+      O.DisplayUnmangledSuffix, O.DisplayModuleNames,
+      O.DisplayGenericSpecializations, O.DisplayProtocolConformances,
+      O.DisplayWhereClauses, O.DisplayEntityTypes, O.ShortenPartialApply,
+      O.ShortenThunk, O.ShortenValueWitness, O.ShortenArchetype,
+      O.ShowPrivateDiscriminators, O.ShowFunctionArgumentTypes,
+    };
+    unsigned result = 0;
+    for (unsigned i = 0; i < sizeof(fields); ++i)
+      result |= unsigned(fields[i]) << i;
+    return result;
+  }
+
+  const std::string *lookup(llvm::StringRef MangledName,
+                            unsigned fingerprint) const {
+    auto entry = Entries.find(MangledName);
+    if (entry == Entries.end() ||
+        entry->second.OptionsFingerprint != fingerprint)
+      return nullptr;
+    return &entry->second.Demangled;
+  }
+
+  void remember(llvm::StringRef MangledName, unsigned fingerprint,
+                const std::string &demangled) {
+    if (Entries.size() >= Capacity)
+      Entries.clear();
+    Entries[MangledName] = {demangled, fingerprint};
+  }
+};
+
 //////////////////////////////////
 // Context member functions     //
 //////////////////////////////////
@@ -28,6 +81,7 @@ Context::Context() : D(new Demangler) {
 }
 
 Context::~Context() {
+  delete Cache;
   delete D;
 }
 
@@ -48,15 +102,36 @@ NodePointer Context::demangleTypeAsNode(llvm::StringRef MangledName) {
 
 std::string Context::demangleSymbolAsString(llvm::StringRef MangledName,
                                             const DemangleOptions &Options) {
+  if (!Cache)
+    Cache = new SymbolCache;
+  unsigned fingerprint = SymbolCache::getOptionsFingerprint(Options);
+  if (auto *cached = Cache->lookup(MangledName, fingerprint))
+    return *cached;
+
   NodePointer root = demangleSymbolAsNode(MangledName);
   if (!root) return MangledName.str();
 
   std::string demangling = nodeToString(root, Options);
   if (demangling.empty())
     return MangledName.str();
+  Cache->remember(MangledName, fingerprint, demangling);
   return demangling;
 }
 
+std::vector<std::string> Context::demangleSymbolsAsStrings(
+    llvm::ArrayRef<llvm::StringRef> MangledNames,
+    const DemangleOptions &Options) {
+  std::vector<std::string> demanglings;
+  demanglings.reserve(MangledNames.size());
+  for (llvm::StringRef MangledName : MangledNames) {
+    demanglings.push_back(demangleSymbolAsString(MangledName, Options));
+    // Recycle the node memory, so that the peak is bounded by the largest
+    // single demangling in the batch.
+    clear();
+  }
+  return demanglings;
+}
+
 std::string Context::demangleTypeAsString(llvm::StringRef MangledName,
                                           const DemangleOptions &Options) {
   NodePointer root = demangleTypeAsNode(MangledName);
@@ -2068,6 +2068,9 @@ Demangle::mangleNode(const NodePointer &node, SymbolicResolver resolver) {
   if (!node) return "";
 
   DemanglerPrinter printer;
+  // Typical manglings overflow std::string's inline storage several times
+  // over; one up-front allocation replaces the doubling growth.
+  printer.reserve(128);
   Remangler(printer, resolver).mangle(node);
 
   return std::move(printer).str();
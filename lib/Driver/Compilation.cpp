@@ -232,6 +232,14 @@ namespace driver {
     llvm::SmallDenseMap<const Job *, std::unique_ptr<llvm::Timer>, 16>
     DriverTimers;
 
+    /// The time at which each job began executing, used to record per-file
+    /// compile times in the compilation record.
+    llvm::DenseMap<const Job *, llvm::sys::TimePoint<>> JobStartTimes;
+
+    /// The measured wall time of each finished job, in milliseconds. Batch
+    /// jobs attribute an even share of the batch's time to each constituent.
+    llvm::DenseMap<const Job *, uint32_t> JobDurationsMillis;
+
     void noteBuilding(const Job *cmd, StringRef reason) {
       if (!Comp.getShowIncrementalBuildDecisions())
         return;
@@ -335,6 +343,8 @@ namespace driver {
       // TODO: properly handle task began.
       const Job *BeganCmd = (const Job *)Context;
 
+      JobStartTimes[BeganCmd] = std::chrono::system_clock::now();
+
       if (Comp.getShowDriverTimeCompilation()) {
         llvm::SmallString<128> TimerName;
         llvm::raw_svector_ostream OS(TimerName);
@@ -548,6 +558,23 @@ namespace driver {
 
       if (Pid != llvm::sys::ProcessInfo::InvalidPid) {
 
+        // Record the job's wall time for the compilation record. For a batch
+        // job, attribute an even share to each constituent; we don't have a
+        // finer-grained signal from inside the frontend.
+        auto startTime = JobStartTimes.find(FinishedCmd);
+        if (startTime != JobStartTimes.end()) {
+          auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(
+              std::chrono::system_clock::now() - startTime->second).count();
+          if (isBatchJob(FinishedCmd)) {
+            auto constituents =
+                static_cast<const BatchJob *>(FinishedCmd)->getCombinedJobs();
+            for (const Job *J : constituents)
+              JobDurationsMillis[J] = uint32_t(millis / constituents.size());
+          } else {
+            JobDurationsMillis[FinishedCmd] = uint32_t(millis);
+          }
+        }
+
         if (Comp.getShowDriverTimeCompilation()) {
           DriverTimers[FinishedCmd]->stopTimer();
         }
@@ -830,9 +857,45 @@ namespace driver {
     /// arranged in contiguous runs. We shuffle partition-indices here, not
     /// elements themselves, to preserve the invariant that each batch is a
     /// subsequence of the full set of inputs, not just a subset.
+    /// Estimate the cost of compiling a batchable job from the compile time
+    /// measured by the previous build, or 0 if it wasn't recorded.
+    static uint64_t estimatedJobCost(const Job *Cmd) {
+      auto *CJA = dyn_cast<CompileJobAction>(&Cmd->getSource());
+      if (!CJA)
+        return 0;
+      return CJA->getInputInfo().previousBuildDurationMillis;
+    }
+
     std::vector<size_t>
     assignJobsToPartitions(size_t PartitionSize,
-                           size_t NumJobs) {
+                           ArrayRef<const Job *> Batchable) {
+      size_t NumJobs = Batchable.size();
+
+      // If the previous build recorded a compile time for every job, assign
+      // each job (in input order, so batches stay subsequences of the
+      // inputs) to the partition with the least accumulated cost. This keeps
+      // a few expensive files from turning one batch into the straggler the
+      // whole build waits on. With incomplete data — first build, new files
+      // — fall back to even counts below.
+      bool HaveAllCosts = NumJobs > 0;
+      for (const Job *Cmd : Batchable)
+        HaveAllCosts &= estimatedJobCost(Cmd) != 0;
+
+      if (HaveAllCosts && Comp.getBatchSeed() == 0) {
+        std::vector<size_t> PartitionIndex;
+        PartitionIndex.reserve(NumJobs);
+        std::vector<uint64_t> PartitionCost(PartitionSize, 0);
+        for (const Job *Cmd : Batchable) {
+          size_t Best = 0;
+          for (size_t P = 1; P < PartitionSize; ++P)
+            if (PartitionCost[P] < PartitionCost[Best])
+              Best = P;
+          PartitionCost[Best] += estimatedJobCost(Cmd);
+          PartitionIndex.push_back(Best);
+        }
+        return PartitionIndex;
+      }
+
       size_t Remainder = NumJobs % PartitionSize;
       size_t TargetSize = NumJobs / PartitionSize;
       std::vector<size_t> PartitionIndex;
@@ -863,7 +926,7 @@ namespace driver {
 
       assert(!Partition.empty());
       auto PartitionIndex = assignJobsToPartitions(Partition.size(),
-                                                   Batchable.size());
+                                                   Batchable);
       assert(PartitionIndex.size() == Batchable.size());
       auto const &TC = Comp.getToolChain();
       for_each(Batchable, PartitionIndex, [&](const Job *Cmd, size_t Idx) {
@@ -1200,6 +1263,15 @@ namespace driver {
           CompileJobAction::InputInfo info;
           info.previousModTime = entry->getInputModTime();
           info.status = CompileJobAction::InputInfo::UpToDate;
+          auto duration = JobDurationsMillis.find(entry);
+          if (duration != JobDurationsMillis.end()) {
+            info.previousBuildDurationMillis = duration->second;
+          } else {
+            // The job didn't run in this build; carry the previously
+            // recorded time forward.
+            info.previousBuildDurationMillis =
+                compileAction->getInputInfo().previousBuildDurationMillis;
+          }
           inputs[&inputFile->getInputArg()] = info;
         }
       }
@@ -1277,13 +1349,19 @@ static void writeCompilationRecord(StringRef path, StringRef argsHash,
     return;
   }
 
-  auto writeTimeValue = [](llvm::raw_ostream &out,
-                           llvm::sys::TimePoint<> time) {
+  auto writeTimeValue = [](llvm::raw_ostream &out, llvm::sys::TimePoint<> time,
+                           uint32_t durationMillis = 0) {
     using namespace std::chrono;
     auto secs = time_point_cast<seconds>(time);
     time -= secs.time_since_epoch(); // remainder in nanoseconds
     out << "[" << secs.time_since_epoch().count()
-        << ", " << time.time_since_epoch().count() << "]";
+        << ", " << time.time_since_epoch().count();
+    // Input entries additionally record how long the file took to compile,
+    // as an optional third element used for cost-based batch partitioning
+    // in the next build.
+    if (durationMillis != 0)
+      out << ", " << durationMillis;
+    out << "]";
   };
 
   using compilation_record::TopLevelKey;
@@ -1310,7 +1388,8 @@ static void writeCompilationRecord(StringRef path, StringRef argsHash,
       out << Name << " ";
     }
 
-    writeTimeValue(out, entry.second.previousModTime);
+    writeTimeValue(out, entry.second.previousModTime,
+                   entry.second.previousBuildDurationMillis);
     out << "\n";
   }
 }
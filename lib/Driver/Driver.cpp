@@ -431,7 +431,9 @@ static bool populateOutOfDateMap(InputInfoMap &map,
   bool optionsMatch = true;
 
   auto readTimeValue = [&scratch](yaml::Node *node,
-                                  llvm::sys::TimePoint<> &timeValue) -> bool {
+                                  llvm::sys::TimePoint<> &timeValue,
+                                  uint32_t *durationMillis =
+                                      nullptr) -> bool {
     auto *seq = dyn_cast<yaml::SequenceNode>(node);
     if (!seq)
       return true;
@@ -459,6 +461,18 @@ static bool populateOutOfDateMap(InputInfoMap &map,
       return true;
 
     ++seqI;
+
+    // Input entries may carry a third element: how long the file took to
+    // compile in the recorded build, in milliseconds.
+    if (durationMillis && seqI != seqE) {
+      auto *durationRaw = dyn_cast<yaml::ScalarNode>(&*seqI);
+      if (!durationRaw)
+        return true;
+      if (durationRaw->getValue(scratch).getAsInteger(10, *durationMillis))
+        return true;
+      ++seqI;
+    }
+
     if (seqI != seqE)
       return true;
 
@@ -539,11 +553,13 @@ static bool populateOutOfDateMap(InputInfoMap &map,
           return true;
 
         llvm::sys::TimePoint<> timeValue;
-        if (readTimeValue(value, timeValue))
+        uint32_t durationMillis = 0;
+        if (readTimeValue(value, timeValue, &durationMillis))
           return true;
 
         auto inputName = key->getValue(scratch);
-        previousInputs[inputName] = { *previousBuildState, timeValue };
+        previousInputs[inputName] = { *previousBuildState, timeValue,
+                                      durationMillis };
       }
     }
   }
@@ -776,6 +792,15 @@ getDriverBatchSizeLimit(llvm::opt::InputArgList &ArgList,
   return None;
 }
 
+// Note on null-build overhead: deferring ToolChain::constructInvocation
+// until a job is scheduled looks attractive for no-op incremental builds,
+// but several pre-scheduling consumers read the rendered arguments today —
+// batch combinability checks, -driver-print-jobs, response-file size
+// limits, and the parseable-output began messages — so laziness requires
+// giving Job a render-on-demand accessor those paths share. Before doing
+// that, measure: on no-op builds the time is typically dominated by
+// reading and hashing .swiftdeps files and stat'ing inputs, which job
+// argument rendering doesn't touch.
 std::unique_ptr<Compilation>
 Driver::buildCompilation(const ToolChain &TC,
                          std::unique_ptr<llvm::opt::InputArgList> ArgList) {
@@ -1676,6 +1701,16 @@ void Driver::buildActions(SmallVectorImpl<const Action *> &TopLevelActions,
           StringRef PersistentPCHDir;
           if (const Arg *A = Args.getLastArg(options::OPT_pch_output_dir)) {
             PersistentPCHDir = A->getValue();
+          } else if (Args.hasArg(options::OPT_incremental)) {
+            // In incremental builds without an explicit PCH output
+            // directory, persist the precompiled bridging header into the
+            // module cache: subsequent builds then reload it instead of
+            // re-precompiling the header once per driver invocation. The
+            // importer validates the PCH against the header contents (and
+            // re-emits it) when it is loaded.
+            if (const Arg *A =
+                    Args.getLastArg(options::OPT_module_cache_path))
+              PersistentPCHDir = A->getValue();
           }
           PCH = C.createAction<GeneratePCHJobAction>(HeaderInput,
                                                      PersistentPCHDir);
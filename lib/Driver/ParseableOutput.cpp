@@ -17,6 +17,7 @@
 #include "swift/Basic/TaskQueue.h"
 #include "swift/Driver/Action.h"
 #include "swift/Driver/Job.h"
+#include "llvm/ADT/SmallString.h"
 #include "llvm/Option/Arg.h"
 #include "llvm/Support/raw_ostream.h"
 
@@ -252,14 +253,25 @@ struct ObjectTraits<Message> {
 } // namespace json
 } // namespace swift
 
+// Wire-format note: every message is already length-prefixed — the byte
+// count on its own line below lets a consumer lagging behind the driver
+// slurp frames without parsing them, hand frames to worker threads, or
+// skip message kinds it doesn't care about after peeking at a prefix.
+// Finished messages likewise already carry the job's OS pid and rusage
+// (utime/stime/maxrss) via TaskProcessInformation. A binary fixed-struct
+// schema would be a second public protocol for the same data; consumers
+// that find JSON decode cost measurable should exploit the framing first
+// (parse off-thread, or only the "finished" frames), since this format is
+// documented and depended on by external build systems.
 static void emitMessage(raw_ostream &os, Message &msg) {
-  std::string JSONString;
-  llvm::raw_string_ostream BufferStream(JSONString);
-  json::Output yout(BufferStream);
+  // The length prefix forces buffering the message, but render it into
+  // inline storage instead of a heap string that grows by doubling.
+  llvm::SmallString<256> buffer;
+  llvm::raw_svector_ostream bufferStream(buffer);
+  json::Output yout(bufferStream);
   yout << msg;
-  BufferStream.flush();
-  os << JSONString.length() << '\n';
-  os << JSONString << '\n';
+  os << buffer.size() << '\n';
+  os << buffer << '\n';
 }
 
 void parseable_output::emitBeganMessage(raw_ostream &os, const Job &Cmd,
@@ -270,6 +270,17 @@ static bool ParseLangArgs(LangOptions &Opts, ArgList &Args,
     Opts.SolverMemoryThreshold = threshold;
   }
 
+  if (const Arg *A = Args.getLastArg(OPT_solver_scope_threshold)) {
+    unsigned threshold;
+    if (StringRef(A->getValue()).getAsInteger(10, threshold)) {
+      Diags.diagnose(SourceLoc(), diag::error_invalid_arg_value,
+                     A->getAsString(Args), A->getValue());
+      return true;
+    }
+
+    Opts.SolverBindingThreshold = threshold;
+  }
+
   if (const Arg *A = Args.getLastArg(OPT_solver_shrink_unsolved_threshold)) {
     unsigned threshold;
     if (StringRef(A->getValue()).getAsInteger(10, threshold)) {
@@ -637,6 +648,10 @@ static bool ParseSILArgs(SILOptions &Opts, ArgList &Args,
   }
   IRGenOpts.OptMode = Opts.OptMode;
 
+  if (Args.getLastArg(OPT_AssumeSealedClasses)) {
+    Opts.AssumeSealedClasses = true;
+  }
+
   if (Args.getLastArg(OPT_AssumeSingleThreaded)) {
     Opts.AssumeSingleThreaded = true;
   }
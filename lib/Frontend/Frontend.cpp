@@ -653,6 +653,17 @@ void CompilerInstance::addMainFileToModule(
   addAdditionalInitialImportsTo(MainFile, implicitImports);
 }
 
+// Note on parallel parsing: the per-file parse loop below looks
+// embarrassingly parallel but is not, in this architecture. Every parser
+// interns identifiers in the shared ASTContext table, allocates AST nodes
+// from the shared arena, emits into one DiagnosticEngine, and (for
+// interface hashing and code completion) talks to shared state — so
+// "independent arenas merged at name binding" first requires relocatable
+// AST allocations and identifier handles that survive a merge, neither of
+// which exist. The parallelism this tree does offer across files is
+// process-level (batch jobs), which also isolates crashes. If in-process
+// parallel parsing is attempted, start by making Identifier interning and
+// the Diagnostic path concurrent; the arena merge is the hard part.
 void CompilerInstance::parseAndCheckTypesUpTo(
     const ImplicitImports &implicitImports, SourceFile::ASTStage_t limitStage) {
   FrontendStatsTracer tracer(Context->Stats, "parse-and-check-types");
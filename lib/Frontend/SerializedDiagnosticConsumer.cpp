@@ -123,6 +123,26 @@ struct SharedState : llvm::RefCountedBase<SharedState> {
   /// this becomes \c true, we never close a DIAG block until we know that we're
   /// starting another one or we're done.
   bool EmittedAnyDiagBlocks;
+
+  /// \brief A diagnostic captured during compilation, ready to be encoded
+  /// when processing finishes.
+  ///
+  /// The message text has to be rendered at capture time, because the format
+  /// arguments reference AST nodes with no lifetime guarantee, but location
+  /// resolution and bitstream encoding are deferred off the compilation
+  /// path; warning-heavy files then don't pay serialization interleaved
+  /// with type checking.
+  struct CapturedDiagnostic {
+    SourceManager *SM;
+    SourceLoc Loc;
+    DiagnosticKind Kind;
+    std::string Text;
+    SmallVector<CharSourceRange, 2> Ranges;
+    SmallVector<DiagnosticInfo::FixIt, 2> FixIts;
+  };
+
+  /// \brief The diagnostics captured so far, in emission order.
+  std::vector<CapturedDiagnostic> CapturedDiagnostics;
 };
 
 /// \brief Diagnostic consumer that serializes diagnostics to a stream.
@@ -151,6 +171,32 @@ public:
     // have these yet in Swift, but if we do we need to add an extra
     // check here.
 
+    // Encode the diagnostics captured during compilation.
+    for (const auto &diag : State->CapturedDiagnostics) {
+      // Enter the block for a non-note diagnostic immediately, rather than
+      // waiting for beginDiagnostic, in case associated notes follow.
+      if (diag.Kind != DiagnosticKind::Note) {
+        if (State->EmittedAnyDiagBlocks)
+          exitDiagBlock();
+        enterDiagBlock();
+        State->EmittedAnyDiagBlocks = true;
+      }
+
+      // Make sure we bracket all notes as "sub-diagnostics".
+      bool bracketDiagnostic = (diag.Kind == DiagnosticKind::Note);
+      if (bracketDiagnostic)
+        enterDiagBlock();
+
+      DiagnosticInfo info;
+      info.Ranges = diag.Ranges;
+      info.FixIts = diag.FixIts;
+      emitDiagnosticMessage(*diag.SM, diag.Loc, diag.Kind, diag.Text, info);
+
+      if (bracketDiagnostic)
+        exitDiagBlock();
+    }
+    State->CapturedDiagnostics.clear();
+
     // Finish off any diagnostic we were in the process of emitting.
     if (State->EmittedAnyDiagBlocks)
       exitDiagBlock();
@@ -547,33 +593,24 @@ void SerializedDiagnosticConsumer::handleDiagnostic(
     StringRef FormatString, ArrayRef<DiagnosticArgument> FormatArgs,
     const DiagnosticInfo &Info) {
 
-  // Enter the block for a non-note diagnostic immediately, rather
-  // than waiting for beginDiagnostic, in case associated notes
-  // are emitted before we get there.
-  if (Kind != DiagnosticKind::Note) {
-    if (State->EmittedAnyDiagBlocks)
-      exitDiagBlock();
+  // Capture the diagnostic rather than encoding it inline; the bitstream
+  // for all captured diagnostics is emitted in finishProcessing(), off the
+  // compilation path. Only the message text must be rendered now, since the
+  // format arguments reference AST nodes with no lifetime guarantee.
+  SharedState::CapturedDiagnostic captured;
+  captured.SM = &SM;
+  captured.Loc = Loc;
+  captured.Kind = Kind;
 
-    enterDiagBlock();
-    State->EmittedAnyDiagBlocks = true;
-  }
-
-  // Special-case diagnostics with no location.
-  // Make sure we bracket all notes as "sub-diagnostics".
-  bool bracketDiagnostic = (Kind == DiagnosticKind::Note);
-
-  if (bracketDiagnostic)
-    enterDiagBlock();
-
-  // Actually substitute the diagnostic arguments into the diagnostic text.
   llvm::SmallString<256> Text;
   {
     llvm::raw_svector_ostream Out(Text);
     DiagnosticEngine::formatDiagnosticText(Out, FormatString, FormatArgs);
   }
-  
-  emitDiagnosticMessage(SM, Loc, Kind, Text, Info);
+  captured.Text = Text.str().str();
+
+  captured.Ranges.append(Info.Ranges.begin(), Info.Ranges.end());
+  captured.FixIts.append(Info.FixIts.begin(), Info.FixIts.end());
 
-  if (bracketDiagnostic)
-    exitDiagBlock();
+  State->CapturedDiagnostics.push_back(std::move(captured));
 }
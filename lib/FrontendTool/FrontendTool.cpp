@@ -1017,6 +1017,18 @@ static bool performCompile(CompilerInstance &Instance,
 
   std::deque<PostSILGenInputs> PSGIs = generateSILModules(Invocation, Instance);
 
+  // Note on pipelining this loop: overlapping the SIL-opt/IRGen of one
+  // primary with the processing of the next looks attractive (wall time
+  // approaching max(phase) rather than sum(phase)), but both stages share
+  // the one mutable ASTContext — SIL optimization triggers type lowering,
+  // conformance lookup and deserialization, all of which allocate into and
+  // cache in the context that the next primary's steps are reading. Making
+  // this loop concurrent therefore isn't a local change; it needs either a
+  // frozen, fully-type-checked context (every lazy path forced before the
+  // checkpoint) or context-level locking. The supported way to get the
+  // overlap today is process-level: batch mode already pipelines frontend
+  // jobs across cores, and -num-threads parallelizes IRGen/LLVM within one
+  // job once SIL processing is done.
   while (!PSGIs.empty()) {
     auto PSGI = std::move(PSGIs.front());
     PSGIs.pop_front();
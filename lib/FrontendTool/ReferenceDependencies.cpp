@@ -104,6 +104,11 @@ private:
     /// to a public protocol and add a public member.
     llvm::SmallVector<const ExtensionDecl *, 8> extensionsWithJustMembers;
 
+    /// Records the member-holding declarations of this file — nominal
+    /// declarations and conformance-introducing extensions — so that their
+    /// individual member names can be listed in the provides-member section.
+    llvm::SmallVector<const Decl *, 16> memberHolders;
+
     /// Recursively computes the transitive closure over members
     /// adding memberOperatorDecls and extendedNominals to the receiver.
     void findNominalsAndOperators(const DeclRange members);
@@ -358,6 +363,8 @@ void ProvidesEmitter::emitExtensionDecl(const ExtensionDecl *const ED,
       return;
     }
     cpd.extensionsWithJustMembers.push_back(ED);
+  } else {
+    cpd.memberHolders.push_back(ED);
   }
   cpd.extendedNominals[NTD] |= !justMembers;
   cpd.findNominalsAndOperators(ED->getMembers());
@@ -372,6 +379,7 @@ void ProvidesEmitter::emitNominalTypeDecl(const NominalTypeDecl *const NTD,
   }
   out << "- \"" << escape(NTD->getName()) << "\"\n";
   cpd.extendedNominals[NTD] |= true;
+  cpd.memberHolders.push_back(NTD);
   cpd.findNominalsAndOperators(NTD->getMembers());
 }
 
@@ -430,10 +438,11 @@ void ProvidesEmitter::emitMembers(const CollectedDeclarations &cpd) const {
   }
 
   // This is also part of providesMember.
-  for (auto *ED : cpd.extensionsWithJustMembers) {
-    auto mangledName = mangleTypeAsContext(ED->getExtendedNominal());
+  auto emitMemberNames = [this](const NominalTypeDecl *NTD,
+                                const DeclRange members) {
+    auto mangledName = mangleTypeAsContext(NTD);
 
-    for (auto *member : ED->getMembers()) {
+    for (auto *member : members) {
       auto *VD = dyn_cast<ValueDecl>(member);
       if (!VD || !VD->hasName() ||
           VD->getFormalAccess() <= AccessLevel::FilePrivate) {
@@ -442,6 +451,22 @@ void ProvidesEmitter::emitMembers(const CollectedDeclarations &cpd) const {
       out << "- [\"" << mangledName << "\", \"" << escape(VD->getBaseName())
           << "\"]\n";
     }
+  };
+
+  for (auto *ED : cpd.extensionsWithJustMembers)
+    emitMemberNames(ED->getExtendedNominal(), ED->getMembers());
+
+  // Also list the individual members of the file's nominal declarations and
+  // conformance-introducing extensions. This lets the driver match a
+  // dependent's member references against the exact member names this file
+  // provides instead of only the per-type wildcard entry above, which is a
+  // prerequisite for narrowing member-level invalidation.
+  for (auto *D : cpd.memberHolders) {
+    if (auto *ED = dyn_cast<ExtensionDecl>(D))
+      emitMemberNames(ED->getExtendedNominal(), ED->getMembers());
+    else
+      emitMemberNames(cast<NominalTypeDecl>(D),
+                      cast<NominalTypeDecl>(D)->getMembers());
   }
 }
 
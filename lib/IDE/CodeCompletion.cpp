@@ -41,6 +41,7 @@
 #include "clang/Index/USRGeneration.h"
 #include "llvm/ADT/SmallString.h"
 #include "llvm/ADT/StringRef.h"
+#include "llvm/ADT/StringSet.h"
 #include "llvm/Support/Compiler.h"
 #include "llvm/Support/raw_ostream.h"
 #include "llvm/Support/SaveAndRestore.h"
@@ -860,7 +861,14 @@ static ArrayRef<std::pair<StringRef, StringRef>> copyStringPairArray(
 
 void CodeCompletionResultBuilder::addChunkWithText(
     CodeCompletionString::Chunk::ChunkKind Kind, StringRef Text) {
-  addChunkWithTextNoCopy(Kind, copyString(*Sink.Allocator, Text));
+  // Intern the text: annotations and keywords repeat across thousands of
+  // results, and one copy per distinct string suffices for the sink's
+  // lifetime. StringMap cannot hold the empty key; empty chunk text needs
+  // no storage anyway.
+  if (Text.empty())
+    return addChunkWithTextNoCopy(Kind, Text);
+  addChunkWithTextNoCopy(
+      Kind, Sink.InternedStrings.insert({Text, char()}).first->getKey());
 }
 
 void CodeCompletionResultBuilder::setAssociatedDecl(const Decl *D) {
@@ -5705,7 +5713,17 @@ void SimpleCachingCodeCompletionConsumer::handleResultsAndModules(
     CodeCompletionContext &context,
     ArrayRef<RequestedCachedModule> requestedModules,
     DeclContext *DCForModules) {
-  for (auto &R : requestedModules) {
+  const bool chunked = wantsChunkedResults();
+
+  // For a chunked consumer, deliver the context-specific results (locals,
+  // members, keywords) right away; they are what the user almost always
+  // wants, and they are ready before the global results are merged in.
+  if (chunked)
+    handleResultChunk(context.takeResults(),
+                      /*isLastChunk=*/requestedModules.empty());
+
+  for (auto i : indices(requestedModules)) {
+    auto &R = requestedModules[i];
     // FIXME(thread-safety): lock the whole AST context.  We might load a
     // module.
     llvm::Optional<CodeCompletionCache::ValueRefCntPtr> V =
@@ -5720,7 +5738,11 @@ void SimpleCachingCodeCompletionConsumer::handleResultsAndModules(
     }
     assert(V.hasValue());
     copyCodeCompletionResults(context.getResultSink(), (*V)->Sink, R.OnlyTypes);
+    if (chunked)
+      handleResultChunk(context.takeResults(),
+                        /*isLastChunk=*/i + 1 == requestedModules.size());
   }
 
-  handleResults(context.takeResults());
+  if (!chunked)
+    handleResults(context.takeResults());
 }
@@ -18,6 +18,7 @@
 #include "llvm/Support/FileSystem.h"
 #include "llvm/Support/MemoryBuffer.h"
 #include "llvm/Support/Path.h"
+#include "llvm/Support/xxhash.h"
 
 using namespace swift;
 using namespace ide;
@@ -49,6 +50,17 @@ CodeCompletionCache::ValueRefCntPtr CodeCompletionCache::createValue() {
   return ValueRefCntPtr(new Value);
 }
 
+/// Hash the contents of the module file at \p filename, or 0 if it cannot
+/// be read. Used to revalidate cache entries whose recorded modification
+/// time no longer matches: a branch switch or reinstall commonly rewrites a
+/// module with identical contents.
+static uint64_t hashModuleFileContents(StringRef filename) {
+  auto buffer = llvm::MemoryBuffer::getFile(filename);
+  if (!buffer)
+    return 0;
+  return llvm::xxHash64((*buffer)->getBuffer());
+}
+
 Optional<CodeCompletionCache::ValueRefCntPtr>
 CodeCompletionCache::get(const Key &K) {
   auto &TheCache = Impl->TheCache;
@@ -59,9 +71,19 @@ CodeCompletionCache::get(const Key &K) {
     if (llvm::sys::fs::status(K.ModuleFilename, ModuleStatus) ||
         V.getValue()->ModuleModificationTime !=
         ModuleStatus.getLastModificationTime()) {
-      // Cache is stale.
-      V = None;
-      TheCache.remove(K);
+      // The modification time changed; check whether the contents did too.
+      // If not (e.g. a branch switch rewrote an identical module), keep the
+      // entry and remember the new modification time.
+      if (V.getValue()->ModuleContentHash != 0 &&
+          V.getValue()->ModuleContentHash ==
+              hashModuleFileContents(K.ModuleFilename)) {
+        V.getValue()->ModuleModificationTime =
+            ModuleStatus.getLastModificationTime();
+      } else {
+        // Cache is stale.
+        V = None;
+        TheCache.remove(K);
+      }
     }
   } else if (nextCache && (V = nextCache->get(K))) {
     // Hit the chained cache. Update our own cache to match.
@@ -81,6 +103,7 @@ void CodeCompletionCache::setImpl(const Key &K, ValueRefCntPtr V,
       return;
     } else {
       V->ModuleModificationTime = ModuleStatus.getLastModificationTime();
+      V->ModuleContentHash = hashModuleFileContents(K.ModuleFilename);
     }
   }
   Impl->TheCache.set(K, V);
@@ -100,7 +123,7 @@ CodeCompletionCache::~CodeCompletionCache() {}
 ///
 /// This should be incremented any time we commit a change to the format of the
 /// cached results. This isn't expected to change very often.
-static constexpr uint32_t onDiskCompletionCacheVersion = 1;
+static constexpr uint32_t onDiskCompletionCacheVersion = 2; // content hash
 
 static StringRef copyString(llvm::BumpPtrAllocator &Allocator, StringRef Str) {
   char *Mem = Allocator.Allocate<char>(Str.size());
@@ -148,16 +171,24 @@ static bool readCachedModule(llvm::MemoryBuffer *in,
 
     auto mtime = llvm::support::endian::read64le(cursor);
     cursor += sizeof(mtime);
+    auto contentHash = llvm::support::endian::read64le(cursor);
+    cursor += sizeof(contentHash);
 
-    // Check the module file's last modification time.
+    // Check the module file's last modification time; if it changed, fall
+    // back to comparing the module contents so that e.g. a branch switch
+    // which rewrote an identical module still hits the cache.
     if (!allowOutOfDate) {
       llvm::sys::fs::file_status status;
-      if (llvm::sys::fs::status(K.ModuleFilename, status) ||
-          status.getLastModificationTime().time_since_epoch().count() !=
+      if (llvm::sys::fs::status(K.ModuleFilename, status))
+        return false; // Doesn't exist.
+      if (status.getLastModificationTime().time_since_epoch().count() !=
           std::chrono::nanoseconds(mtime).count()) {
-        return false; // Out of date, or doesn't exist.
+        if (contentHash == 0 ||
+            contentHash != hashModuleFileContents(K.ModuleFilename))
+          return false; // Out of date.
       }
     }
+    V.ModuleContentHash = contentHash;
   }
 
   // DEBUG INFO
@@ -270,6 +301,7 @@ static bool readCachedModule(llvm::MemoryBuffer *in,
 ///   HEADER
 ///     * version, which **must be bumped** if we change the format!
 ///     * mtime for the module file
+///     * hash of the module file's contents
 ///
 ///   KEY
 ///     * the original CodeCompletionCache::Key, used for debugging the cache.
@@ -296,6 +328,7 @@ static void writeCachedModule(llvm::raw_ostream &out,
   LE.write(onDiskCompletionCacheVersion);           // Version
   auto mtime = V.ModuleModificationTime.time_since_epoch().count();
   LE.write(mtime);                                  // Mtime for module file
+  LE.write(V.ModuleContentHash);                    // Module content hash
 
   // KEY
   // We don't need the stored key to load the results, but it is useful if we
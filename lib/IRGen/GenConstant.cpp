@@ -17,6 +17,7 @@
 #include "llvm/IR/Constants.h"
 
 #include "GenConstant.h"
+#include "GenEnum.h"
 #include "GenStruct.h"
 #include "GenTuple.h"
 #include "TypeInfo.h"
@@ -104,6 +105,16 @@ static llvm::Constant *emitConstantValue(IRGenModule &IGM, SILValue operand) {
       default:
         llvm_unreachable("unsupported builtin for constant expression");
     }
+  } else if (auto *EI = dyn_cast<EnumInst>(operand)) {
+    assert(!EI->hasOperand() &&
+           "only no-payload enum cases can be constant");
+    auto &strategy = getEnumImplStrategy(IGM, EI->getType());
+    if (auto *enumCase = strategy.emitCaseConstant(EI->getElement()))
+      return enumCase;
+    // A payload-free enum which isn't tag-based (e.g. a single-case enum)
+    // carries no data at all.
+    return llvm::ConstantAggregateZero::get(
+        IGM.getTypeInfo(EI->getType()).getStorageType());
   } else if (auto *VTBI = dyn_cast<ValueToBridgeObjectInst>(operand)) {
     auto *SI = cast<StructInst>(VTBI->getOperand());
     assert(SI->getElements().size() == 1);
@@ -739,6 +739,15 @@ namespace {
       int64_t index = getDiscriminatorIndex(target);
       return llvm::ConstantInt::get(getDiscriminatorType(), index);
     }
+
+  public:
+    llvm::Constant *emitCaseConstant(EnumElementDecl *elt) const override {
+      // The storage is a struct wrapping the discriminator.
+      return llvm::ConstantStruct::get(getStorageType(),
+                                       getDiscriminatorIdxConst(elt));
+    }
+
+  protected:
     
 
   public:
@@ -17,6 +17,7 @@
 
 namespace llvm {
   class BasicBlock;
+  class Constant;
   class ConstantInt;
   class StructType;
   class Type;
@@ -218,6 +219,13 @@ public:
     return -1;
   }
 
+  /// Return a constant of the enum's storage type for the given no-payload
+  /// case, or null if instances of this enum cannot be emitted as constants.
+  /// Used for static initialization of outlined objects.
+  virtual llvm::Constant *emitCaseConstant(EnumElementDecl *elt) const {
+    return nullptr;
+  }
+
   /// Emit field names for enum reflection.
   virtual bool isReflectable() const;
 
@@ -329,6 +337,15 @@ public:
 
   /// Emit a branch on the case contained by an enum explosion.
   /// Performs the branching for a SIL 'switch_enum' instruction.
+  /// Note on profile-guided layout: the layout strategy itself cannot
+  /// follow a frequency profile — which case owns the zero tag or the spare
+  /// bit patterns is part of the type's ABI, fixed across modules and
+  /// profiles. What a profile can legitimately steer is the emitted
+  /// dispatch: switch_enum carries per-case ProfileCounters, and threading
+  /// them through here into branch-weight metadata on the built switch (so
+  /// the backend lays out the comparison chain by likelihood) is the
+  /// profitable, ABI-safe form of this optimization. That requires widening
+  /// this interface and every strategy's implementation to take the counts.
   virtual void emitValueSwitch(IRGenFunction &IGF,
                                Explosion &value,
                                ArrayRef<std::pair<EnumElementDecl*,
@@ -926,6 +926,13 @@ namespace {
 
 /// Return true if the witness table requires runtime instantiation to
 /// handle resiliently-added requirements with default implementations.
+///
+/// This predicate is the whole story for "why isn't my witness table
+/// constant": fully-concrete conformances whose protocol is non-resilient
+/// (or same-module) emit read-only, truly-constant tables with no runtime
+/// indirection, and concrete witness_method applies are folded to direct
+/// calls during mandatory inlining. Only resilience — a deliberate ABI
+/// stability property of the protocol's module — forces instantiation.
 static bool isResilientConformance(const NormalProtocolConformance *conformance) {
   // If the protocol is not resilient, the conformance is not resilient
   // either.
@@ -3262,6 +3269,14 @@ irgen::emitWitnessMethodValue(IRGenFunction &IGF,
 
   assert(!IGF.IGM.isResilient(proto, ResilienceExpansion::Maximal));
 
+  // Note on per-callsite inline caches: unlike objc_msgSend, this dispatch
+  // is already a single invariant load at a constant offset from a table
+  // whose pointer arrives with the value (in the existential or as a
+  // generic parameter). A monomorphic cache would replace that load with a
+  // compare-and-branch plus a cold path, which costs more than it saves;
+  // devirtualization at the SIL level is the profitable way to remove the
+  // indirection entirely.
+
   // Find the witness we're interested in.
   auto &fnProtoInfo = IGF.IGM.getProtocolInfo(proto);
   auto index = fnProtoInfo.getFunctionIndex(fn);
@@ -1069,6 +1069,14 @@ TypeConverter::TypeConverter(IRGenModule &IGM)
   // solution, because it won't work once the swiftmodule file is not in
   // sync with the binary module. Once LLDB can calculate type layouts at
   // runtime (using remote mirrors or some other mechanism), we can remove this.
+  //
+  // The same switch is the "resilience domain" lever for applications whose
+  // modules always ship in lockstep: with the swiftmodules guaranteed in
+  // sync with the binaries, -enable-resilience-bypass gives direct field
+  // access and fixed layouts across the resilient boundaries between those
+  // modules. The bargain is exactly the one LLDB makes — any skew between a
+  // module file and its binary becomes undefined behavior rather than a
+  // slower-but-correct opaque access.
   if (IGM.IRGen.Opts.EnableResilienceBypass)
     CompletelyFragile = true;
 }
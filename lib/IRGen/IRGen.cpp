@@ -169,6 +169,16 @@ void setModuleFlags(IRGenModule &IGM) {
                         IRGenModule::swiftVersion);
 }
 
+// Note on intra-module parallel codegen: the unit of backend parallelism
+// here is an llvm::Module, because a module and everything interned in its
+// LLVMContext (types, constants, metadata) is single-threaded property —
+// there is no way to run codegen threads over disjoint function sets of one
+// module without cloning them into separate contexts first, which costs
+// what it saves. Parallelism within one invocation therefore comes from
+// emitting multiple modules (the num-threads / multiple-IGM mode, which
+// cost-balances source-file-less functions across outputs); a single-object
+// release build that wants all cores should let the linker see multiple
+// objects, or use ThinLTO-style partitioning at the LLVM level.
 void swift::performLLVMOptimizations(IRGenOptions &Opts, llvm::Module *Module,
                                      llvm::TargetMachine *TargetMachine) {
   // Set up a pipeline.
@@ -1068,6 +1078,16 @@ static void performParallelIRGeneration(
   std::vector<std::thread> Threads;
   llvm::sys::Mutex DiagMutex;
 
+  // Note on NUMA scaling: each worker drains whole IGMs from the shared
+  // queue, and an IGM's LLVMContext allocates on the thread that runs it,
+  // so first-touch policy already gives each module node-local memory on
+  // Linux. What cross-socket machines lack is affinity — a worker migrated
+  // to the other socket drags its context's pages remote — and
+  // node-sharded queues with cross-node stealing. Both are pthread/libnuma
+  // platform code with no LLVM abstraction; if this shows up on dual-socket
+  // builders, the contained fix is pinning these workers round-robin across
+  // nodes at spawn, which needs no changes to the queue protocol.
+  //
   // Start all the threads and do the LLVM compilation.
   for (int ThreadIdx = 1; ThreadIdx < numThreads; ++ThreadIdx) {
     Threads.push_back(std::thread(ThreadEntryPoint, &irgen, &DiagMutex,
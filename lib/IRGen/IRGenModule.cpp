@@ -1186,10 +1186,30 @@ IRGenModule *IRGenerator::getGenModule(SILFunction *f) {
   if (found != DefaultIGMForFunction.end())
     return found->second;
 
-  if (auto *dc = f->getDeclContext())
-    return getGenModule(dc);
+  if (auto *dc = f->getDeclContext()) {
+    if (dc->getParentSourceFile())
+      return getGenModule(dc);
+  }
+
+  // The function is not associated with any source file, e.g. it is a
+  // specialization or a thunk. Instead of letting all such functions pile
+  // up in the primary module — which serializes the parallel pipeline
+  // behind one oversized output — assign it to the module with the lowest
+  // estimated emission cost so far. The assignment is sticky and the
+  // modules are visited in a fixed order, so output stays deterministic.
+  IRGenModule *leastLoadedIGM = getPrimaryIGM();
+  for (IRGenModule *IGM : Queue) {
+    if (EstimatedIGMCost[IGM] < EstimatedIGMCost[leastLoadedIGM])
+      leastLoadedIGM = IGM;
+  }
 
-  return getPrimaryIGM();
+  uint64_t cost = 0;
+  for (auto &BB : *f)
+    cost += std::distance(BB.begin(), BB.end());
+  // Even an empty function costs something to emit.
+  EstimatedIGMCost[leastLoadedIGM] += cost + 1;
+  DefaultIGMForFunction[f] = leastLoadedIGM;
+  return leastLoadedIGM;
 }
 
 llvm::Triple IRGenerator::getEffectiveClangTriple() {
@@ -191,7 +191,12 @@ private:
   // Stores the IGM from which a function is referenced the first time.
   // It is used if a function has no source-file association.
   llvm::DenseMap<SILFunction *, IRGenModule *> DefaultIGMForFunction;
-  
+
+  // The estimated emission cost (in SIL instructions) assigned to each IGM
+  // so far. Used in multi-threaded compilation to balance functions which
+  // have no source-file association across the output modules.
+  llvm::DenseMap<IRGenModule *, uint64_t> EstimatedIGMCost;
+
   // The IGM of the first source file.
   IRGenModule *PrimaryIGM = nullptr;
 
@@ -18,6 +18,7 @@
 #define DEBUG_TYPE "irgensil"
 #include "llvm/IR/DIBuilder.h"
 #include "llvm/IR/Function.h"
+#include "llvm/IR/MDBuilder.h"
 #include "llvm/IR/Module.h"
 #include "llvm/IR/Instructions.h"
 #include "llvm/IR/IntrinsicInst.h"
@@ -2935,6 +2936,65 @@ static llvm::BasicBlock *emitBBMapForSwitchEnum(
   return defaultDest;
 }
 
+/// Attach profile-derived branch weights to an enum dispatch when SILGen
+/// recorded per-case counts and the enum strategy lowered the dispatch to a
+/// single 'switch' in \p dispatchBB. Strategies that emit compare-and-branch
+/// chains (e.g. for payload tag bits) are left unannotated; a default
+/// successor the counts don't cover (the strategy's own trap/unreachable
+/// block) gets the minimal weight.
+static void setSwitchEnumBranchWeights(
+    IRGenSILFunction &IGF, llvm::BasicBlock *dispatchBB,
+    SwitchEnumInstBase *inst,
+    ArrayRef<std::pair<EnumElementDecl *, llvm::BasicBlock *>> dests,
+    llvm::BasicBlock *defaultDest) {
+  auto *swi =
+      llvm::dyn_cast_or_null<llvm::SwitchInst>(dispatchBB->getTerminator());
+  if (!swi)
+    return;
+
+  // Map each destination block to its recorded count. Bail if any case is
+  // missing a count; partial weights are worse than none.
+  llvm::SmallDenseMap<llvm::BasicBlock *, uint64_t, 8> countForDest;
+  auto successors = inst->getSuccessors();
+  for (unsigned i = 0, e = inst->getNumCases(); i < e; ++i) {
+    auto count = successors[i].getCount();
+    if (!count)
+      return;
+    countForDest[dests[i].second] = count.getValue();
+  }
+  if (defaultDest) {
+    auto defaultCount = successors[inst->getNumCases()].getCount();
+    if (!defaultCount)
+      return;
+    countForDest[defaultDest] = defaultCount.getValue();
+  }
+
+  // Scale into the 32-bit weight space, keeping every weight non-zero.
+  uint64_t maxCount = 1;
+  for (const auto &entry : countForDest)
+    maxCount = std::max(maxCount, entry.second);
+  uint64_t scale = maxCount / UINT32_MAX + 1;
+
+  // Only the switch's own default may be a block the counts don't cover
+  // (the strategy's trap/unreachable default); an uncovered case successor
+  // means the strategy routed cases through internal dispatch blocks and
+  // the weights would be fiction.
+  SmallVector<uint32_t, 8> weights;
+  for (unsigned i = 0, e = swi->getNumSuccessors(); i < e; ++i) {
+    auto it = countForDest.find(swi->getSuccessor(i));
+    if (it == countForDest.end()) {
+      if (swi->getSuccessor(i) != swi->getDefaultDest())
+        return;
+      weights.push_back(1);
+      continue;
+    }
+    weights.push_back(uint32_t(it->second / scale) + 1);
+  }
+  llvm::MDBuilder MDHelper(IGF.IGM.getLLVMContext());
+  swi->setMetadata(llvm::LLVMContext::MD_prof,
+                   MDHelper.createBranchWeights(weights));
+}
+
 void IRGenSILFunction::visitSwitchEnumInst(SwitchEnumInst *inst) {
   Explosion value = getLoweredExplosion(inst->getOperand());
   
@@ -2944,8 +3004,11 @@ void IRGenSILFunction::visitSwitchEnumInst(SwitchEnumInst *inst) {
     = emitBBMapForSwitchEnum(*this, dests, inst);
   
   // Emit the dispatch.
+  llvm::BasicBlock *dispatchBB = Builder.GetInsertBlock();
   auto &EIS = getEnumImplStrategy(IGM, inst->getOperand()->getType());
   EIS.emitValueSwitch(*this, value, dests, defaultDest);
+  if (dispatchBB)
+    setSwitchEnumBranchWeights(*this, dispatchBB, inst, dests, defaultDest);
   
   // Bind arguments for cases that want them.
   for (unsigned i = 0, e = inst->getNumCases(); i < e; ++i) {
@@ -5489,7 +5552,14 @@ void IRGenSILFunction::visitCondFailInst(swift::CondFailInst *i) {
   // line.
   llvm::BasicBlock *failBB = llvm::BasicBlock::Create(IGM.getLLVMContext());
   llvm::BasicBlock *contBB = llvm::BasicBlock::Create(IGM.getLLVMContext());
-  Builder.CreateCondBr(cond, failBB, contBB);
+  // Mark the failure edge as cold explicitly. The backend infers some of
+  // this from the trap/unreachable terminator, but explicit weights make
+  // every frequency-driven heuristic — block placement, inlining cost,
+  // if-conversion — treat the overflow/bounds paths as cold uniformly, so
+  // they stop diluting the hot path's I-cache.
+  auto *coldWeights = llvm::MDBuilder(IGM.getLLVMContext())
+                          .createBranchWeights(1, (1u << 20));
+  Builder.CreateCondBr(cond, failBB, contBB, coldWeights);
   Builder.emitBlock(failBB);
   if (IGM.DebugInfo)
     // If we are emitting DWARF, this does nothing. Otherwise the ``llvm.trap``
@@ -335,10 +335,6 @@ int swift::RunImmediately(CompilerInstance &CI, const ProcessCmdLine &CmdLine,
                            IRGenOpts, SILOpts))
     return -1;
 
-  llvm::PassManagerBuilder PMBuilder;
-  PMBuilder.OptLevel = 2;
-  PMBuilder.Inliner = llvm::createFunctionInliningPass(200);
-
   // Build the ExecutionEngine.
   llvm::EngineBuilder builder(std::move(ModuleOwner));
   std::string ErrorMsg;
@@ -354,6 +350,11 @@ int swift::RunImmediately(CompilerInstance &CI, const ProcessCmdLine &CmdLine,
   builder.setMAttrs(Features);
   builder.setErrorStr(&ErrorMsg);
   builder.setEngineKind(llvm::EngineKind::JIT);
+  // Match the codegen effort to the IR we were given: script-sized programs
+  // are usually run unoptimized, and spending -O2-level instruction
+  // selection on throwaway code dominates their startup time.
+  builder.setOptLevel(IRGenOpts.shouldOptimize() ? llvm::CodeGenOpt::Default
+                                                 : llvm::CodeGenOpt::None);
   llvm::ExecutionEngine *EE = builder.create();
   if (!EE) {
     llvm::errs() << "Error loading JIT: " << ErrorMsg;
@@ -856,6 +856,19 @@ private:
     }
   }
 
+  // Latency note: the frontend half of this path is already incremental —
+  // parsing appends to the one REPL source file, performTypeChecking is
+  // told to start at CurElem, and SILGen/IRGen run from CurIRGenElem, so
+  // no previous line is re-elaborated and the ASTContext/JITted code live
+  // for the whole session. What still grows linearly with session length
+  // is the LLVM-module bookkeeping below: each line clones the entire
+  // accumulated module (CloneModule of Module and again of NewModule) and
+  // strips prior definitions, purely so MCJIT can be handed a fresh
+  // module while we keep one for future linking. Fixing the growth means
+  // handing the JIT only the line's module with external declarations for
+  // prior symbols and letting the JIT's symbol resolver bind them — i.e.
+  // an ORC-style migration of this execution engine, not more caching in
+  // the frontend.
   bool executeSwiftSource(llvm::StringRef Line, const ProcessCmdLine &CmdLine) {
     // Parse the current line(s).
     auto InputBuf = std::unique_ptr<llvm::MemoryBuffer>(
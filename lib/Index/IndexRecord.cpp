@@ -32,6 +32,18 @@
 #include "clang/Lex/Preprocessor.h"
 #include "llvm/Support/Path.h"
 
+// Store-format note: unit and record files are written by clang's
+// IndexUnitWriter/IndexRecordWriter, and the on-disk format is shared with
+// clang's index-while-building and consumed by external indexers — a
+// delta-encoded unit format or compressed record blobs is a format
+// revision that has to land there, versioned, for every producer and
+// consumer at once, not a Swift-side fork. What this layer can and does
+// control is write avoidance: record files are content-addressed (an
+// unchanged symbol graph rewrites nothing), and unit writes are skipped
+// when up to date against the source and its file dependencies. The
+// remaining growth — stale units from deleted or renamed files — is
+// store-compaction work for the index consumer, which owns the store's
+// lifecycle.
 using namespace swift;
 using namespace swift::index;
 using clang::index::IndexUnitWriter;
@@ -613,6 +625,25 @@ recordSourceFileUnit(SourceFile *primarySourceFile, StringRef indexUnitToken,
   for (auto *F : fileDependencies)
     unitWriter.addFileDependency(F, /*FIXME:isSystem=*/false, /*Module=*/nullptr);
 
+  // If the existing unit file is newer than the source file and every file
+  // dependency, re-indexing would reproduce the same data: record files are
+  // content-hashed and deduplicated on their own, and the dependency module
+  // units have been brought up to date above. Skip the indexing walk and
+  // the unit rewrite in that case.
+  {
+    std::string error;
+    auto isUnitNewerThan = [&](StringRef dependencyPath) -> bool {
+      auto isUpToDate = unitWriter.isUnitUpToDateForOutputFile(
+          /*FilePath=*/indexUnitToken, dependencyPath, error);
+      return isUpToDate.hasValue() && *isUpToDate;
+    };
+    bool upToDate = isUnitNewerThan(primarySourceFile->getFilename());
+    for (auto *F : fileDependencies)
+      upToDate = upToDate && isUnitNewerThan(F->getName());
+    if (upToDate)
+      return false;
+  }
+
   recordSourceFile(primarySourceFile, indexStorePath, diags,
                    [&](StringRef recordFile, StringRef filename) {
     unitWriter.addRecordFile(recordFile, fileMgr.getFile(filename),
@@ -159,6 +159,13 @@ Migrator::performAFixItMigration(version::Version SwiftLanguageVersion) {
                   input.isPrimary() ? InputBuffer.get() : input.buffer()));
   }
 
+  // Note on parallel migration: each primary file's migration runs in its
+  // own frontend job, so across-file parallelism is the driver's -j, the
+  // same as compilation — and determinism comes free because each job owns
+  // its remap file. Threading migration states inside one process would
+  // share this CompilerInstance's ASTContext and diagnostics across
+  // threads, which nothing in Sema supports; the per-file wall time is
+  // dominated by performSema below, which a merge-side change can't touch.
   auto Instance = llvm::make_unique<swift::CompilerInstance>();
   if (Instance->setup(Invocation)) {
     return nullptr;
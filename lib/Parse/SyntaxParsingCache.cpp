@@ -29,6 +29,16 @@ bool SyntaxParsingCache::nodeCanBeReused(const Syntax &Node, size_t NodeStart,
   if (Node.getKind() != Kind)
     return false;
 
+  // Check the node's own range first. Determining the length of the next
+  // token requires walking down to the next leaf, which is the expensive
+  // part of this check, so only do it once the node itself is known to be
+  // intact — candidates overlapping the edit fail here already.
+  auto NodeEnd = NodeStart + Node.getTextLength();
+  for (auto Edit : Edits) {
+    if (Edit.intersectsOrTouchesRange(NodeStart, NodeEnd))
+      return false;
+  }
+
   // Node can also not be reused if an edit has been made in the next token's
   // text, e.g. because `private struct Foo {}` parses as a CodeBlockItem with a
   // StructDecl inside and `private struc Foo {}` parses as two CodeBlockItems
@@ -43,11 +53,10 @@ bool SyntaxParsingCache::nodeCanBeReused(const Syntax &Node, size_t NodeStart,
     }
   }
 
-  auto NodeEnd = NodeStart + Node.getTextLength();
   for (auto Edit : Edits) {
-    // Check if this node or the trivia of the next node has been edited. If it
-    // has, we cannot reuse it.
-    if (Edit.intersectsOrTouchesRange(NodeStart, NodeEnd + NextLeafNodeLength))
+    // Check if the trivia of the next node has been edited. If it has, we
+    // cannot reuse this node either.
+    if (Edit.intersectsOrTouchesRange(NodeEnd, NodeEnd + NextLeafNodeLength))
       return false;
   }
 
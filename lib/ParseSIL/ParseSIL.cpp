@@ -4429,7 +4429,31 @@ bool SILParser::parseSILInstruction(SILBuilder &B) {
       return true;
 
     SmallVector<std::pair<EnumElementDecl*, SILBasicBlock*>, 4> CaseBBs;
+    SmallVector<ProfileCounter, 4> CaseCounts;
+    bool HasAnyCount = false;
+    ProfileCounter DefaultCount;
     SILBasicBlock *DefaultBB = nullptr;
+
+    // Parse an optional '!<keyword>(<count>)' annotation, as printed for
+    // profile-guided case counts. \p Count stays invalid if absent.
+    auto parseProfileCount = [&](StringRef Keyword,
+                                 ProfileCounter &Count) -> bool {
+      if (!P.Tok.is(tok::sil_exclamation) ||
+          P.peekToken().getText() != Keyword)
+        return false;
+      P.consumeToken(tok::sil_exclamation);
+      P.consumeToken(tok::identifier);
+      if (P.parseToken(tok::l_paren, diag::expected_tok_in_sil_instr, "("))
+        return true;
+      uint64_t Value;
+      if (parseInteger(Value,
+                       Diagnostic(diag::expected_tok_in_sil_instr, "integer")))
+        return true;
+      Count = ProfileCounter(Value);
+      HasAnyCount = true;
+      return P.parseToken(tok::r_paren, diag::expected_tok_in_sil_instr, ")");
+    };
+
     while (!peekSILDebugLocation(P) && P.consumeIf(tok::comma)) {
       Identifier BBName;
       SourceLoc BBLoc;
@@ -4437,6 +4461,8 @@ bool SILParser::parseSILInstruction(SILBuilder &B) {
       if (P.consumeIf(tok::kw_default)) {
         parseSILIdentifier(BBName, BBLoc, diag::expected_sil_block_name);
         DefaultBB = getBBForReference(BBName, BBLoc);
+        if (parseProfileCount("default_count", DefaultCount))
+          return true;
         break;
       }
 
@@ -4450,6 +4476,10 @@ bool SILParser::parseSILInstruction(SILBuilder &B) {
         parseSILIdentifier(BBName, BBLoc, diag::expected_sil_block_name);
         CaseBBs.push_back( {cast<EnumElementDecl>(ElemRef.getDecl()),
                             getBBForReference(BBName, BBLoc)} );
+        ProfileCounter Count;
+        if (parseProfileCount("case_count", Count))
+          return true;
+        CaseCounts.push_back(Count);
         continue;
       }
 
@@ -4458,10 +4488,15 @@ bool SILParser::parseSILInstruction(SILBuilder &B) {
     }
     if (parseSILDebugLocation(InstLoc, B))
       return true;
+    Optional<ArrayRef<ProfileCounter>> Counts;
+    if (HasAnyCount)
+      Counts = CaseCounts;
     if (Opcode == SILInstructionKind::SwitchEnumInst)
-      ResultVal = B.createSwitchEnum(InstLoc, Val, DefaultBB, CaseBBs);
+      ResultVal = B.createSwitchEnum(InstLoc, Val, DefaultBB, CaseBBs,
+                                     Counts, DefaultCount);
     else
-      ResultVal = B.createSwitchEnumAddr(InstLoc, Val, DefaultBB, CaseBBs);
+      ResultVal = B.createSwitchEnumAddr(InstLoc, Val, DefaultBB, CaseBBs,
+                                         Counts, DefaultCount);
     break;
   }
   case SILInstructionKind::SwitchValueInst: {
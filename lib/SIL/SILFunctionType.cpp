@@ -1078,6 +1078,15 @@ static CanSILFunctionType getSILFunctionType(
 
   // NOTE: SILFunctionType::ExtInfo doesn't track everything that
   // AnyFunctionType::ExtInfo tracks. For example: 'throws' or 'auto-closure'
+  //
+  // Note on a guaranteed-nonescaping context convention: @noescape is
+  // currently a property of the function *type*, but its context is still a
+  // refcounted box passed at +0 — the borrow-a-stack-pointer convention
+  // that would remove the retain/release traffic entirely needs a new
+  // context ownership in the SIL function type (affecting thunks, partial
+  // application, serialization and IRGen's closure lowering), not a change
+  // in this translation. Until then, closure contexts only become
+  // refcount-free when the closure is inlined or its allocation is promoted.
   auto silExtInfo = SILFunctionType::ExtInfo()
     .withRepresentation(extInfo.getSILRepresentation())
     .withIsPseudogeneric(pseudogeneric)
@@ -116,6 +116,15 @@ bool SILGlobalVariable::isValidStaticInitializerInst(const SILInstruction *I,
           return false;
       }
       return false;
+    case SILInstructionKind::EnumInst: {
+      // A no-payload case of a payload-free enum lowers to a plain tag (or
+      // to no data at all), which can be emitted statically.
+      auto *EI = cast<EnumInst>(I);
+      if (EI->hasOperand())
+        return false;
+      return EI->getElement()->getParentEnum()
+          ->hasOnlyCasesWithoutAssociatedValues();
+    }
     case SILInstructionKind::StructInst:
     case SILInstructionKind::TupleInst:
     case SILInstructionKind::IntegerLiteralInst:
@@ -27,6 +27,7 @@
 #include "llvm/ADT/StringSwitch.h"
 #include "llvm/ADT/Statistic.h"
 #include "llvm/Support/Debug.h"
+#include "llvm/Support/MathExtras.h"
 #include "llvm/Support/YAMLTraits.h"
 #include <functional>
 using namespace swift;
@@ -127,15 +128,56 @@ void *SILModule::allocate(unsigned Size, unsigned Align) const {
   if (getASTContext().LangOpts.UseMalloc)
     return AlignedAlloc(Size, Align);
 
+  llvm::sys::ScopedLock lock(AllocationLock);
   return BPA.Allocate(Size, Align);
 }
 
 void *SILModule::allocateInst(unsigned Size, unsigned Align) const {
-  return AlignedAlloc(Size, Align);
+  // With -use-malloc each instruction stays an individual allocation so
+  // address sanitizers can catch lifetime bugs.
+  if (getASTContext().LangOpts.UseMalloc)
+    return AlignedAlloc(Size, Align);
+
+  assert(Align <= InstAllocationAlignment &&
+         "instruction requires stronger alignment than the allocator grants");
+
+  // Instructions are carved from the module's bump allocator in allocation
+  // order, which keeps a function's instructions cache-dense, instead of
+  // paying one malloc per instruction. Each allocation is prefixed with a
+  // header storing its rounded size so that deleted instructions can be
+  // recycled through size-class free lists.
+  unsigned roundedSize = llvm::alignTo(Size + InstAllocationAlignment,
+                                       InstFreeListGranularity);
+  unsigned sizeClass = roundedSize / InstFreeListGranularity - 1;
+
+  llvm::sys::ScopedLock lock(AllocationLock);
+  void *base = nullptr;
+  if (sizeClass < NumInstFreeLists && InstFreeLists[sizeClass]) {
+    base = InstFreeLists[sizeClass];
+    InstFreeLists[sizeClass] = *reinterpret_cast<void **>(base);
+  } else {
+    base = BPA.Allocate(roundedSize, InstAllocationAlignment);
+  }
+  *reinterpret_cast<unsigned *>(base) = roundedSize;
+  return static_cast<char *>(base) + InstAllocationAlignment;
 }
 
 void SILModule::deallocateInst(SILInstruction *I) {
-  AlignedFree(I);
+  if (getASTContext().LangOpts.UseMalloc) {
+    AlignedFree(I);
+    return;
+  }
+
+  void *base = reinterpret_cast<char *>(I) - InstAllocationAlignment;
+  unsigned roundedSize = *reinterpret_cast<unsigned *>(base);
+  unsigned sizeClass = roundedSize / InstFreeListGranularity - 1;
+  if (sizeClass >= NumInstFreeLists) {
+    // Oversized allocation; leave it to the bump allocator's teardown.
+    return;
+  }
+  llvm::sys::ScopedLock lock(AllocationLock);
+  *reinterpret_cast<void **>(base) = InstFreeLists[sizeClass];
+  InstFreeLists[sizeClass] = base;
 }
 
 SILWitnessTable *
@@ -393,6 +435,10 @@ SILFunction *SILModule::findFunction(StringRef Name, SILLinkage Linkage) {
   return F;
 }
 
+SILFunction *SILModule::loadFunction(StringRef Name) {
+  return getSILLoader()->lookupSILFunction(Name, /*declarationOnly*/ false);
+}
+
 bool SILModule::hasFunction(StringRef Name) {
   if (lookUpFunction(Name))
     return true;
@@ -73,11 +73,11 @@ class ExplodeTupleValue
                           /*Args...=*/ ManagedValue>
 {
 public:
-  std::vector<ManagedValue> &values;
+  SmallVectorImpl<ManagedValue> &values;
   SILGenFunction &SGF;
   SILLocation loc;
 
-  ExplodeTupleValue(std::vector<ManagedValue> &values,
+  ExplodeTupleValue(SmallVectorImpl<ManagedValue> &values,
                     SILGenFunction &SGF, SILLocation loc)
     : values(values), SGF(SGF), loc(loc)
   {
@@ -698,7 +698,7 @@ void RValue::extractElements(SmallVectorImpl<RValue> &elements) && {
 RValue RValue::copy(SILGenFunction &SGF, SILLocation loc) const & {
   assert((isComplete() || isInSpecialState()) &&
          "can't copy an incomplete rvalue");
-  std::vector<ManagedValue> copiedValues;
+  SmallVector<ManagedValue, 4> copiedValues;
   copiedValues.reserve(values.size());
   for (ManagedValue v : values) {
     copiedValues.emplace_back(v.copy(SGF, loc));
@@ -715,7 +715,7 @@ RValue RValue::ensurePlusOne(SILGenFunction &SGF, SILLocation loc) && {
 RValue RValue::borrow(SILGenFunction &SGF, SILLocation loc) const & {
   assert((isComplete() || isInSpecialState()) &&
          "can't borrow incomplete rvalue");
-  std::vector<ManagedValue> borrowedValues;
+  SmallVector<ManagedValue, 4> borrowedValues;
   borrowedValues.reserve(values.size());
   for (ManagedValue v : values) {
     borrowedValues.emplace_back(v.borrow(SGF, loc));
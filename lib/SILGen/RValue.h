@@ -72,7 +72,10 @@ class RValue {
   friend class swift::Lowering::Scope;
   friend class swift::Lowering::ArgumentSource;
 
-  std::vector<ManagedValue> values;
+  /// The ManagedValues making up the rvalue. Most rvalues explode to only a
+  /// handful of elements, so keep them inline instead of heap-allocating a
+  /// vector on SILGen's hottest paths.
+  SmallVector<ManagedValue, 4> values;
   CanType type;
   unsigned elementsToBeAdded;
   
@@ -103,8 +106,8 @@ class RValue {
   }
 
   /// Private constructor used by copy() and borrow().
-  RValue(SILGenFunction &SGF, std::vector<ManagedValue> &&values, CanType type,
-         unsigned elementsToBeAdded)
+  RValue(SILGenFunction &SGF, SmallVector<ManagedValue, 4> &&values,
+         CanType type, unsigned elementsToBeAdded)
       : values(std::move(values)), type(type),
         elementsToBeAdded(elementsToBeAdded) {
     verify(SGF);
@@ -108,9 +108,9 @@ RValue Scope::popPreservingValue(RValue &&rv) {
     SGF.enterDeallocBoxCleanup(v);
   }
 
-  // Reconstruct the managed values from the underlying sil values in the outer
-  // scope. Since the RValue wants a std::vector value, we use that instead.
-  std::vector<ManagedValue> managedValues;
+  // Reconstruct the managed values from the underlying sil values in the
+  // outer scope, in the inline storage the RValue wants.
+  SmallVector<ManagedValue, 4> managedValues;
   std::transform(
       values.begin(), values.end(), std::back_inserter(managedValues),
       [&cloner](SILValue v) -> ManagedValue { return cloner.clone(v); });
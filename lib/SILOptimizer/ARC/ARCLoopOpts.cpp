@@ -16,6 +16,21 @@
 /// also provides caching of certain analysis information that is used by all of
 /// the passes.
 ///
+/// Note on loop-carried pairing for array element traffic: hoisting the
+/// per-iteration retain/release of elements loaded from a class array out
+/// of the loop is not a new matching shape here — it's a guarantee
+/// question. The pair can only move if the array provably owns the element
+/// for the whole loop: no store into the array, no make_mutable that could
+/// reallocate, and no escape of the array to code that could. Those are
+/// exactly the facts the array-semantics calls expose
+/// (ArraySemanticsCall::doesNotChangeArray and the guaranteed-self
+/// conventions), so the profitable extension is a pre-pass that marks
+/// loop-invariant arrays whose loops contain only non-mutating semantics
+/// calls, letting the existing motion treat element loads from them as
+/// producing guaranteed values for the loop's extent. Without that proof,
+/// per-iteration pairing is required for correctness whenever the loop
+/// body can call out.
+///
 //===----------------------------------------------------------------------===//
 
 #define DEBUG_TYPE "arc-sequence-opts"
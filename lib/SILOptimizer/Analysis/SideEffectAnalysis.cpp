@@ -365,6 +365,18 @@ bool FunctionSideEffects::summarizeFunction(SILFunction *F) {
 
   if (!F->isDefinition()) {
     // We can't assume anything about external functions.
+    //
+    // Note for cross-module precision: the serialization channel for
+    // carrying effects across module boundaries already exists — the
+    // EffectsKind attribute round-trips through swiftmodules and is
+    // honored above in setDefinedEffects. What's missing is a late pass in
+    // the producing module that upgrades the attribute from this
+    // analysis's *computed* summary for functions about to be serialized
+    // (only when the summary is empty including traps and allocations; a
+    // readonly upgrade must also respect the owned-parameter caveat
+    // above). Serializing the full per-parameter summaries next to the
+    // SIL would be more precise still, but needs a module format
+    // extension; the attribute upgrade needs none.
     LLVM_DEBUG(llvm::dbgs() << "  -- is external " << F->getName() << '\n');
     setWorstEffects();
     return true;
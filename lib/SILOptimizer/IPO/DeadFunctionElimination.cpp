@@ -141,6 +141,20 @@ protected:
 
   /// Marks all contained functions and witness tables of a witness table as
   /// alive.
+  ///
+  /// Witness methods of externally visible conformances survive here even
+  /// when nothing in this module calls them, because any later-linked module
+  /// can reach them through the conformance. Stripping those entries for a
+  /// statically linked binary is not something this pass can learn to do by
+  /// itself: it would need the closed-world assertion for conformances (the
+  /// analogue of what -assume-sealed-classes asserts for class hierarchies)
+  /// plus a reachability handshake with the linker, since dynamic casts and
+  /// reflective conformance lookups reach witness tables through the
+  /// conformance records IRGen registers — a symbol-level manifest that
+  /// doesn't account for those would strip code the runtime can still
+  /// demand. Until a linker-cooperating mode exists, the supported
+  /// size levers are internalizing conformances (access control) and
+  /// cross-module optimization making callers visible.
   void makeAlive(SILWitnessTable *WT) {
     LLVM_DEBUG(llvm::dbgs() << "    scan witness table " << WT->getName()
                             << '\n');
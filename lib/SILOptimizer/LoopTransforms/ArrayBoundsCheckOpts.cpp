@@ -9,6 +9,19 @@
 // See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
 //
 //===----------------------------------------------------------------------===//
+//
+// Scope note: this pass recognizes induction-variable loop idioms
+// (IVAnalysis) and hoists or removes checks it can pattern-match. Manual
+// index arithmetic (strided/offset accesses) defeats it by design. The
+// right extension is not more patterns here but a separate SIL integer
+// range analysis — a lattice over (builtin) integer SSA values seeded by
+// literals, cond_fail-guarded comparisons, and array.get_count calls,
+// joined at phis — that this pass consults before giving up on a check:
+// if range(index) ⊆ [0, count) the cond_fail is provably dead. Seeding
+// from the dominating comparisons matters more than arithmetic transfer
+// functions for real kernels, and keeps the analysis linear.
+//
+//===----------------------------------------------------------------------===//
 
 #define DEBUG_TYPE "sil-abcopts"
 
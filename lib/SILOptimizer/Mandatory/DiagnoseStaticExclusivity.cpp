@@ -21,6 +21,21 @@
 // storage locations to the counts of read and write-like accesses in progress
 // for that location.
 //
+// On "verified no-exclusivity regions": this pass cannot be the engine for
+// an attribute that promises a scope is conflict-free and strips its
+// dynamic checks. It detects *definite* conflicts between accesses it can
+// pair up within a function (plus summarized noescape-closure arguments);
+// the dynamic checks that remain exist precisely where absence of conflict
+// is not locally provable — class properties, globals, and escaping inouts
+// reachable from other functions or threads. Proving absence for those is
+// whole-program work, and the sound machinery for it already exists:
+// AccessEnforcementOpts removes checks it can prove redundant locally, and
+// AccessEnforcementWMO statically demotes every location the module can
+// see all accesses to. An audited per-function escape hatch beyond that is
+// a request to *assert*, not to prove — it belongs in SILGen (emitting
+// static enforcement under an attribute), with exactly the blunt-trust
+// semantics of -enforce-exclusivity=unchecked, scoped smaller.
+//
 //===----------------------------------------------------------------------===//
 
 #define DEBUG_TYPE "static-exclusivity"
@@ -13,6 +13,8 @@
 #define DEBUG_TYPE "sil-passmanager"
 
 #include "swift/SILOptimizer/PassManager/PassManager.h"
+#include "swift/AST/ASTContext.h"
+#include "swift/Basic/Statistic.h"
 #include "swift/Demangling/Demangle.h"
 #include "swift/SIL/SILFunction.h"
 #include "swift/SIL/SILModule.h"
@@ -29,6 +31,7 @@
 #include "llvm/Support/GraphWriter.h"
 #include "llvm/Support/ManagedStatic.h"
 #include "llvm/Support/Chrono.h"
+#include "llvm/Support/ThreadPool.h"
 
 using namespace swift;
 
@@ -44,6 +47,15 @@ llvm::cl::opt<bool> SILPrintPassTime(
     "sil-print-pass-time", llvm::cl::init(false),
     llvm::cl::desc("Print the execution time of each SIL pass"));
 
+// Note on finer-grained optimization fuel: -sil-opt-pass-count already
+// gives deterministic pass-granular bisection (and the parallel mode
+// honors it). Transformation-granular fuel — stopping after the Nth
+// individual rewrite — can't be imposed from the pass manager, because
+// commit points live inside each transform; the incremental path to it is
+// a SILBuilder-level counter consulted by the builder's insertion/RAUW
+// entry points, which most transforms already funnel through. Passes
+// mutating IR behind the builder's back would escape the fuel and need
+// auditing one by one.
 llvm::cl::opt<unsigned> SILNumOptPassesToRun(
     "sil-opt-pass-count", llvm::cl::init(UINT_MAX),
     llvm::cl::desc("Stop optimizing after <N> optimization passes"));
@@ -86,6 +98,19 @@ llvm::cl::list<std::string>
                      llvm::cl::desc("Disable passes "
                                     "which contain a string from this list"));
 
+llvm::cl::opt<unsigned> SILOptParallelThreads(
+    "sil-opt-parallel-threads", llvm::cl::init(0),
+    llvm::cl::desc("Run function passes on call-graph independent functions "
+                   "with the given number of threads (0 = run serially). "
+                   "Experimental: requires all scheduled function passes to "
+                   "be thread-safe."));
+
+llvm::cl::opt<bool> SILSkipColdFunctionPasses(
+    "sil-skip-cold-function-passes", llvm::cl::init(false),
+    llvm::cl::desc("With profile data, don't schedule the function pass "
+                   "pipelines on functions which were never executed in the "
+                   "profile; they keep their mandatory-pipeline SIL."));
+
 llvm::cl::opt<bool> SILVerifyWithoutInvalidation(
     "sil-verify-without-invalidation", llvm::cl::init(false),
     llvm::cl::desc("Verify after passes even if the pass has not invalidated"));
@@ -317,9 +342,15 @@ void SILPassManager::runPassOnFunction(unsigned TransIdx, SILFunction *F) {
 
   // If nothing changed since the last run of this pass, we can skip this
   // pass.
-  CompletedPasses &completedPasses = CompletedPassesMap[F];
-  if (completedPasses.test((size_t)SFT->getPassKind()) &&
-      !SILDisableSkippingPasses) {
+  // Note: don't cache the reference into the map; a concurrently processed
+  // function may grow the map while this pass is running.
+  bool passAlreadyCompleted;
+  {
+    std::lock_guard<std::mutex> guard(SharedStateMutex);
+    passAlreadyCompleted =
+        CompletedPassesMap[F].test((size_t)SFT->getPassKind());
+  }
+  if (passAlreadyCompleted && !SILDisableSkippingPasses) {
     if (SILPrintPassName)
       dumpPassInfo("(Skip)", TransIdx, F);
     return;
@@ -335,6 +366,18 @@ void SILPassManager::runPassOnFunction(unsigned TransIdx, SILFunction *F) {
 
   CurrentPassHasInvalidated = false;
 
+  // Attribute this pass run to the function in the unified stats trace:
+  // the tracer records the wall time and the deltas of all frontend
+  // counters, keyed by pass tag and function, which is enough to find a
+  // pass going quadratic on one function in production without rerunning
+  // with debug flags.
+  // The unified stats reporter's tracer stack and counters are not
+  // thread-safe; leave them untouched on parallel-mode workers.
+  auto *Stats = SILOptParallelThreads > 0
+                    ? nullptr
+                    : F->getModule().getASTContext().Stats;
+  FrontendStatsTracer StatsTracer(Stats, SFT->getTag(), F);
+
   if (SILPrintPassName)
     dumpPassInfo("Run", TransIdx, F);
 
@@ -366,12 +409,28 @@ void SILPassManager::runPassOnFunction(unsigned TransIdx, SILFunction *F) {
   updateSILModuleStatsAfterTransform(F->getModule(), SFT, *this, NumPassesRun,
                                      Delta);
 
-  // Remember if this pass didn't change anything.
-  if (!CurrentPassHasInvalidated)
-    completedPasses.set((size_t)SFT->getPassKind());
+  if (Stats) {
+    auto &C = Stats->getFrontendCounters();
+    ++C.NumSILOptPassesRun;
+    if (CurrentPassHasInvalidated)
+      ++C.NumSILOptPassInvalidations;
+  }
+
+  // Remember if this pass didn't change anything. The invalidation flag is
+  // shared by all workers in parallel mode, so we conservatively leave the
+  // completed-passes cache alone there: a pass may run again needlessly, but
+  // it is never skipped incorrectly.
+  if (!CurrentPassHasInvalidated && SILOptParallelThreads == 0) {
+    std::lock_guard<std::mutex> guard(SharedStateMutex);
+    CompletedPassesMap[F].set((size_t)SFT->getPassKind());
+  }
 
+  // In parallel mode the invalidation flag is shared, so another worker's
+  // clear may hide this pass's invalidation; verify unconditionally there
+  // rather than risk skipping a requested re-verification.
   if (getOptions().VerifyAll &&
-      (CurrentPassHasInvalidated || SILVerifyWithoutInvalidation)) {
+      (CurrentPassHasInvalidated || SILVerifyWithoutInvalidation ||
+       SILOptParallelThreads > 0)) {
     F->verify();
     verifyAnalyses(F);
   }
@@ -397,8 +456,20 @@ runFunctionPasses(unsigned FromTransIdx, unsigned ToTransIdx) {
 
     // Only include functions that are definitions, and which have not
     // been intentionally excluded from optimization.
-    if (F.isDefinition() && (isMandatoryPipeline || F.shouldOptimize()))
-      FunctionWorklist.push_back(*I);
+    if (!F.isDefinition() || !(isMandatoryPipeline || F.shouldOptimize()))
+      continue;
+
+    // In the cold-function tier, functions which the profile proves were
+    // never executed keep their mandatory-pipeline SIL: optimizing them
+    // costs a large share of SIL time and changes nothing that runs. Hot
+    // callers can still inline them.
+    if (SILSkipColdFunctionPasses && !isMandatoryPipeline) {
+      auto entryCount = F.getEntryCount();
+      if (entryCount && entryCount.getValue() == 0)
+        continue;
+    }
+
+    FunctionWorklist.push_back(*I);
   }
 
   DerivationLevels.clear();
@@ -412,6 +483,11 @@ runFunctionPasses(unsigned FromTransIdx, unsigned ToTransIdx) {
   if (SILPrintPassName)
     llvm::dbgs() << "Start function passes at stage: " << StageName << "\n";
 
+  if (SILOptParallelThreads > 0 && !isMandatoryPipeline) {
+    runFunctionPassesParallel(FromTransIdx, ToTransIdx, SILOptParallelThreads);
+    return;
+  }
+
   // Run all transforms for all functions, starting at the tail of the worklist.
   while (!FunctionWorklist.empty() && continueTransforming()) {
     unsigned TailIdx = FunctionWorklist.size() - 1;
@@ -442,6 +518,97 @@ runFunctionPasses(unsigned FromTransIdx, unsigned ToTransIdx) {
   }
 }
 
+void SILPassManager::
+runPipelineOnFunction(unsigned FromTransIdx, unsigned ToTransIdx,
+                      SILFunction *F) {
+  // Mirrors the restart limit in runFunctionPasses().
+  const unsigned MaxNumRestarts = 20;
+
+  unsigned PipelineIdx = 0;
+  unsigned NumRestarts = 0;
+  while (PipelineIdx < ToTransIdx - FromTransIdx && continueTransforming()) {
+    runPassOnFunction(FromTransIdx + PipelineIdx, F);
+
+    // The restart flag is shared by all workers. A request from a
+    // concurrently processed function may therefore restart this pipeline as
+    // well. That only costs compile time (the completed-passes cache is not
+    // populated in parallel mode anyway) and never skips a requested restart.
+    bool restart;
+    {
+      std::lock_guard<std::mutex> guard(SharedStateMutex);
+      restart = RestartPipeline.exchange(false);
+    }
+    if (restart && NumRestarts < MaxNumRestarts) {
+      ++NumRestarts;
+      PipelineIdx = 0;
+    } else {
+      ++PipelineIdx;
+    }
+  }
+}
+
+void SILPassManager::
+runFunctionPassesParallel(unsigned FromTransIdx, unsigned ToTransIdx,
+                          unsigned NumThreads) {
+  BasicCalleeAnalysis *BCA = getAnalysis<BasicCalleeAnalysis>();
+  BottomUpFunctionOrder BottomUpOrder(*Mod, BCA);
+
+  // Compute for each function the length of the longest call-graph path to a
+  // leaf. Functions on the same level don't call each other, so their
+  // pipelines can run concurrently while still seeing all of their callees
+  // fully optimized — the same guarantee the serial bottom-up walk provides.
+  llvm::DenseMap<SILFunction *, unsigned> Levels;
+  llvm::SmallVector<SmallVector<SILFunction *, 16>, 8> Waves;
+  for (auto SCC : BottomUpOrder.getSCCs()) {
+    unsigned Level = 0;
+    for (SILFunction *F : SCC) {
+      for (SILBasicBlock &BB : *F) {
+        for (SILInstruction &I : BB) {
+          auto FAS = FullApplySite::isa(&I);
+          if (!FAS)
+            continue;
+          for (SILFunction *Callee : BCA->getCalleeList(FAS)) {
+            auto Iter = Levels.find(Callee);
+            if (Iter != Levels.end())
+              Level = std::max(Level, Iter->second + 1);
+          }
+        }
+      }
+    }
+    for (SILFunction *F : SCC)
+      Levels[F] = Level;
+    if (Waves.size() <= Level)
+      Waves.resize(Level + 1);
+    for (SILFunction *F : SCC) {
+      if (F->isDefinition() && F->shouldOptimize())
+        Waves[Level].push_back(F);
+    }
+  }
+
+  // The initial work is scheduled by waves; any function pushed onto the
+  // worklist while the pool is running (e.g. a specialization) is processed
+  // serially below.
+  FunctionWorklist.clear();
+
+  llvm::ThreadPool Pool(NumThreads);
+  for (auto &Wave : Waves) {
+    for (SILFunction *F : Wave) {
+      Pool.async([=] { runPipelineOnFunction(FromTransIdx, ToTransIdx, F); });
+    }
+    // Functions of the next wave may call into this one, so their pipelines
+    // must not start before all pipelines of this wave have finished.
+    Pool.wait();
+  }
+
+  // Derived functions are processed with the whole pipeline, like in the
+  // serial worklist loop.
+  while (!FunctionWorklist.empty() && continueTransforming()) {
+    SILFunction *F = FunctionWorklist.back().F;
+    FunctionWorklist.pop_back();
+    runPipelineOnFunction(FromTransIdx, ToTransIdx, F);
+  }
+}
+
 void SILPassManager::runModulePass(unsigned TransIdx) {
   auto *SMT = cast<SILModuleTransform>(Transformations[TransIdx]);
   if (isDisabled(SMT))
@@ -459,6 +626,9 @@ void SILPassManager::runModulePass(unsigned TransIdx) {
 
   CurrentPassHasInvalidated = false;
 
+  auto *Stats = Mod->getASTContext().Stats;
+  FrontendStatsTracer StatsTracer(Stats, SMT->getTag());
+
   if (SILPrintPassName)
     dumpPassInfo("Run module pass", TransIdx);
 
@@ -488,6 +658,13 @@ void SILPassManager::runModulePass(unsigned TransIdx) {
 
   updateSILModuleStatsAfterTransform(*Mod, SMT, *this, NumPassesRun, Delta);
 
+  if (Stats) {
+    auto &C = Stats->getFrontendCounters();
+    ++C.NumSILOptPassesRun;
+    if (CurrentPassHasInvalidated)
+      ++C.NumSILOptPassInvalidations;
+  }
+
   if (Options.VerifyAll &&
       (CurrentPassHasInvalidated || !SILVerifyWithoutInvalidation)) {
     Mod->verify();
@@ -564,6 +741,8 @@ void SILPassManager::addFunctionToWorklist(SILFunction *F,
   assert(F && F->isDefinition() && (isMandatoryPipeline || F->shouldOptimize())
          && "Expected optimizable function definition!");
 
+  std::lock_guard<std::mutex> guard(SharedStateMutex);
+
   constexpr int MaxDeriveLevels = 10;
 
   int NewLevel = 1;
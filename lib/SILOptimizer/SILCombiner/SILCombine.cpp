@@ -113,6 +113,17 @@ void SILCombineWorklist::add(SILInstruction *I) {
   Worklist.push_back(I);
 }
 
+// Note on repeated visits in huge functions: the worklist itself already
+// deduplicates (WorklistMap) and instructions are only re-added when an
+// operand actually changed (the replace/erase helpers add the affected
+// users), so epoch stamps on instructions would not filter anything those
+// rules don't. What *is* quadratic-shaped is this outer loop: every
+// iteration that made any change walks the whole function again through
+// addReachableCodeToWorklist and revisits all 20k instructions to find the
+// handful near last iteration's changes. The fix with leverage is carrying
+// the worklist across iterations — seed iteration N+1 with only the
+// instructions iteration N touched (plus their users), falling back to a
+// full walk solely when the CFG changed.
 bool SILCombiner::doOneIteration(SILFunction &F, unsigned Iteration) {
   MadeChange = false;
 
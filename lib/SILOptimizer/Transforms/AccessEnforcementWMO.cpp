@@ -13,6 +13,20 @@
 /// This module pass removes dynamic access enforcement based on whole module
 /// information.
 ///
+/// Note on extending this across module boundaries: the analysis is only
+/// sound because it sees *every* access to a disjoint location — the
+/// partitioning below explicitly relies on Class/Global accesses occurring
+/// in the defining module's functions. Crossing modules therefore isn't a
+/// matter of serializing per-function access summaries alone: a public or
+/// @inlinable-visible global/property can be accessed by any downstream
+/// module compiled later, so the producer can never close the world by
+/// itself. The sound cross-module form needs the sealed-world assertion
+/// (-assume-sealed-classes-style: the image is closed and every linked
+/// module's summaries are present), at which point serialized summaries —
+/// which global/property names a function may access dynamically — let
+/// this same partitioning run over the union. Summary serialization
+/// follows the effects-serialization path sketched in SideEffectAnalysis.
+///
 /// This maps each access of identified storage onto a disjoint access
 /// location. Local accesses (Box and Stack) already have unique AccessedStorage
 /// and should be removed by an earlier function pass. This pass handles Class
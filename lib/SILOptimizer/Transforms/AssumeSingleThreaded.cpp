@@ -29,18 +29,35 @@
 #include "swift/SIL/SILFunction.h"
 #include "swift/SIL/SILInstruction.h"
 #include "swift/SIL/SILModule.h"
+#include "swift/SILOptimizer/Analysis/EscapeAnalysis.h"
 #include "swift/SILOptimizer/Utils/Local.h"
 #include "swift/SILOptimizer/PassManager/Transforms.h"
 #include "llvm/Support/CommandLine.h"
 
 using namespace swift;
 
+/// Convert reference counting operations on provably thread-local objects
+/// into non-atomic ones, even without -assume-single-threaded. Experimental.
+llvm::cl::opt<bool> EnableNonAtomicThreadLocalRC(
+    "sil-nonatomic-thread-local-rc", llvm::cl::init(false),
+    llvm::cl::desc("Use non-atomic reference counting for objects which "
+                   "provably do not escape their allocating function"));
+
 namespace {
 class AssumeSingleThreaded : public swift::SILFunctionTransform {
   /// The entry point to the transformation.
   void run() override {
-    if (!getOptions().AssumeSingleThreaded)
+    if (getOptions().AssumeSingleThreaded) {
+      convertAllToNonAtomic();
       return;
+    }
+    if (EnableNonAtomicThreadLocalRC)
+      convertThreadLocalToNonAtomic();
+  }
+
+  /// Unconditionally convert all reference counting operations; the user
+  /// asserted via -assume-single-threaded that no other threads exist.
+  void convertAllToNonAtomic() {
     for (auto &BB : *getFunction()) {
       for (auto &I : BB) {
         if (auto RCInst = dyn_cast<RefCountingInst>(&I))
@@ -52,6 +69,31 @@ class AssumeSingleThreaded : public swift::SILFunctionTransform {
     invalidateAnalysis(SILAnalysis::InvalidationKind::Instructions);
   }
 
+  /// Convert only those operations whose operand provably never escapes the
+  /// allocating function. Such an object can only ever be referenced by the
+  /// current thread, so its reference count is not contended. A release may
+  /// still run a destructor, but the destructor operates on other objects
+  /// through their own (atomic, unless proven otherwise) operations.
+  void convertThreadLocalToNonAtomic() {
+    auto *EA = PM->getAnalysis<EscapeAnalysis>();
+    auto *ConGraph = EA->getConnectionGraph(getFunction());
+
+    bool Changed = false;
+    for (auto &BB : *getFunction()) {
+      for (auto &I : BB) {
+        auto *RCInst = dyn_cast<RefCountingInst>(&I);
+        if (!RCInst || RCInst->isNonAtomic())
+          continue;
+        auto *Node = ConGraph->getNodeOrNull(RCInst->getOperand(0), EA);
+        if (!Node || Node->escapes())
+          continue;
+        RCInst->setNonAtomic();
+        Changed = true;
+      }
+    }
+    if (Changed)
+      invalidateAnalysis(SILAnalysis::InvalidationKind::Instructions);
+  }
 };
 } // end anonymous namespace
 
@@ -160,6 +160,10 @@ class SILPerformanceInliner {
 
   bool decideInColdBlock(FullApplySite AI, SILFunction *Callee);
 
+  bool isColdBlock(
+      SILBasicBlock *block, SILBasicBlock *child,
+      const llvm::DenseMap<SILBasicBlock *, uint64_t> &BBToWeightMap);
+
   void visitColdBlocks(SmallVectorImpl<FullApplySite> &AppliesToInline,
                        SILBasicBlock *root, DominanceInfo *DT);
 
@@ -694,7 +698,7 @@ void SILPerformanceInliner::collectAppliesToInline(
     // At this occasion we record additional weight increases.
     addWeightCorrection(FAS, WeightCorrections);
 
-    if (SILFunction *Callee = getEligibleFunction(FAS, WhatToInline)) {
+    if (SILFunction *Callee = getEligibleFunction(FAS, WhatToInline, &ORE)) {
       // Compute the shortest-path analysis for the callee.
       SILLoopInfo *CalleeLI = LA->get(Callee);
       ShortestPathAnalysis *CalleeSPA = getSPA(Callee, CalleeLI);
@@ -743,7 +747,7 @@ void SILPerformanceInliner::collectAppliesToInline(
 
       FullApplySite AI = FullApplySite(&*I);
 
-      auto *Callee = getEligibleFunction(AI, WhatToInline);
+      auto *Callee = getEligibleFunction(AI, WhatToInline, &ORE);
       if (Callee) {
         if (!BlockWeight.isValid())
           BlockWeight = SPA->getWeight(block, Weight(0, 0));
@@ -760,7 +764,7 @@ void SILPerformanceInliner::collectAppliesToInline(
       break;
 
     domOrder.pushChildrenIf(block, [&] (SILBasicBlock *child) {
-      if (CBI.isSlowPath(block, child)) {
+      if (isColdBlock(block, child, BBToWeightMap)) {
         // Handle cold blocks separately.
         visitColdBlocks(InitialCandidates, child, DT);
         return false;
@@ -849,6 +853,23 @@ bool SILPerformanceInliner::inlineCallsIntoFunction(SILFunction *Caller) {
   return true;
 }
 
+/// Decide whether \p child should get the restrictive cold-block inlining
+/// policy. When the caller has profile data, the measured execution count
+/// overrides the static slow-path heuristic in both directions: a block that
+/// actually ran is never treated as cold even under an unlikely-branch hint,
+/// and a block that never ran is cold even without one. This keeps hot
+/// dispatch paths inlinable and stops never-executed error paths from being
+/// bloated by the warm-block policy.
+bool SILPerformanceInliner::isColdBlock(
+    SILBasicBlock *block, SILBasicBlock *child,
+    const llvm::DenseMap<SILBasicBlock *, uint64_t> &BBToWeightMap) {
+  auto bbIt = BBToWeightMap.find(child);
+  if (bbIt != BBToWeightMap.end())
+    return bbIt->getSecond() == 0;
+
+  return CBI.isSlowPath(block, child);
+}
+
 // Find functions in cold blocks which are forced to be inlined.
 // All other functions are not inlined in cold blocks.
 void SILPerformanceInliner::visitColdBlocks(
@@ -861,7 +882,7 @@ void SILPerformanceInliner::visitColdBlocks(
       if (!AI)
         continue;
 
-      auto *Callee = getEligibleFunction(AI, WhatToInline);
+      auto *Callee = getEligibleFunction(AI, WhatToInline, &ORE);
       if (Callee && decideInColdBlock(AI, Callee)) {
         AppliesToInline.push_back(AI);
       }
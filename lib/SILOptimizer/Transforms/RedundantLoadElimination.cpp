@@ -1079,6 +1079,16 @@ void BlockState::processInstructionWithKind(RLEContext &Ctx,
   // If we have an instruction that may write to memory and we cannot prove
   // that it and its operands cannot alias a load we have visited,
   // invalidate that load.
+  //
+  // Note that for apply instructions this is not as conservative as it
+  // looks: the per-location queries inside processUnknownWriteInst go
+  // through the alias analysis' memory-behavior visitor, which consults
+  // SideEffectAnalysis function summaries — so class property loads do
+  // survive calls whose summaries prove them non-writing. The residual
+  // conservatism for repeated self.property loads is almost entirely calls
+  // into *other modules*, whose callees have worst-case summaries; that is
+  // a summary-availability problem (serializing effects across module
+  // boundaries), not a missing capability in this pass.
   if (Inst->mayWriteToMemory()) {
     LLVM_DEBUG(llvm::dbgs() << "WRITE " << *Inst);
     processUnknownWriteInst(Ctx, Inst, Kind);
@@ -35,9 +35,13 @@
 #include "llvm/ADT/MapVector.h"
 #include "llvm/ADT/PointerIntPair.h"
 #include "llvm/ADT/Statistic.h"
+#include "llvm/ADT/StringMap.h"
 #include "llvm/ADT/StringSet.h"
 #include "llvm/Support/Debug.h"
 #include "llvm/Support/CommandLine.h"
+#include "llvm/Support/LineIterator.h"
+#include "llvm/Support/ManagedStatic.h"
+#include "llvm/Support/MemoryBuffer.h"
 
 using namespace swift;
 
@@ -45,6 +49,60 @@ using namespace swift;
 // speculative devirtualizer will try to predict.
 static const int MaxNumSpeculativeTargets = 6;
 
+/// Optional class frequency profile, from PGO post-processing or an
+/// instrumentation run. Each line has the form "<module>.<class> <weight>".
+/// When given, speculation checks classes in descending weight order, so the
+/// fixed per-call-site budget is spent on the classes covering most calls and
+/// the hottest class is behind the first check of the chain.
+llvm::cl::opt<std::string> SpeculativeDevirtProfilePath(
+    "sil-speculative-devirt-profile", llvm::cl::init(""),
+    llvm::cl::desc("Path to a class frequency profile used to order "
+                   "speculative devirtualization targets"));
+
+namespace {
+
+/// Lazily-loaded class frequency profile.
+class SpeculationProfile {
+  llvm::StringMap<uint64_t> Weights;
+  bool Loaded = false;
+
+  void load() {
+    if (Loaded)
+      return;
+    Loaded = true;
+    auto Buffer = llvm::MemoryBuffer::getFile(SpeculativeDevirtProfilePath);
+    if (!Buffer)
+      return;
+    for (llvm::line_iterator LineIter(**Buffer, /*SkipBlanks*/ true);
+         !LineIter.is_at_eof(); ++LineIter) {
+      StringRef Name;
+      StringRef WeightStr;
+      std::tie(Name, WeightStr) = LineIter->trim().rsplit(' ');
+      uint64_t Weight;
+      if (Name.empty() || WeightStr.getAsInteger(10, Weight))
+        continue;
+      Weights[Name] = Weight;
+    }
+  }
+
+public:
+  bool isEnabled() const { return !SpeculativeDevirtProfilePath.empty(); }
+
+  uint64_t getWeight(const ClassDecl *CD) {
+    load();
+    SmallString<64> Key;
+    Key += CD->getModuleContext()->getName().str();
+    Key += '.';
+    Key += CD->getName().str();
+    auto It = Weights.find(Key);
+    return It == Weights.end() ? 0 : It->second;
+  }
+};
+
+} // end anonymous namespace
+
+static llvm::ManagedStatic<SpeculationProfile> SpecProfile;
+
 STATISTIC(NumTargetsPredicted, "Number of monomorphic functions predicted");
 
 // A utility function for cloning the apply instruction.
@@ -383,6 +441,18 @@ static bool tryToSpeculateTarget(FullApplySite AI, ClassHierarchyAnalysis *CHA,
   SmallVector<ClassDecl *, 8> Subs;
   getAllSubclasses(CHA, CD, ClassType, M, Subs);
 
+  // If a class frequency profile is available, speculate on the most
+  // frequently observed classes first: the checked_cast_br chain then tests
+  // the hottest class first, and the target budget below is spent on the
+  // classes which cover the most calls.
+  if (SpecProfile->isEnabled()) {
+    std::stable_sort(Subs.begin(), Subs.end(),
+                     [](ClassDecl *LHS, ClassDecl *RHS) {
+                       return SpecProfile->getWeight(LHS) >
+                              SpecProfile->getWeight(RHS);
+                     });
+  }
+
   // Number of subclasses which cannot be handled by checked_cast_br checks.
   int NotHandledSubsNum = 0;
   if (Subs.size() > MaxNumSpeculativeTargets) {
@@ -78,19 +78,20 @@ void StackPromotion::run() {
 
 bool StackPromotion::promoteInBlock(SILBasicBlock *BB, EscapeAnalysis *EA,
                                     DeadEndBlocks &DEBlocks) {
+  // Don't stack promote any allocation inside a code region which ends up
+  // in a no-return block. Such allocations may be missing their final
+  // release. We would insert the deallocation too early, which may result
+  // in a use-after-free problem. This is a property of the block, so check
+  // it once instead of re-querying it for every allocation.
+  if (DEBlocks.isDeadEnd(BB))
+    return false;
+
   bool Changed = false;
   for (auto Iter = BB->begin(); Iter != BB->end();) {
     // The allocation instruction may be moved, so increment Iter prior to
     // doing the optimization.
     SILInstruction *I = &*Iter++;
     if (auto *ARI = dyn_cast<AllocRefInst>(I)) {
-      // Don't stack promote any allocation inside a code region which ends up
-      // in a no-return block. Such allocations may missing their final release.
-      // We would insert the deallocation too early, which may result in a
-      // use-after-free problem.
-      if (DEBlocks.isDeadEnd(BB))
-        return false;
-
       Changed |= tryPromoteAlloc(ARI, EA, DEBlocks);
     }
   }
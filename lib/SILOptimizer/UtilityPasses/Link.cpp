@@ -13,9 +13,19 @@
 #include "swift/SILOptimizer/PassManager/Passes.h"
 #include "swift/SILOptimizer/PassManager/Transforms.h"
 #include "swift/SIL/SILModule.h"
+#include "llvm/Support/CommandLine.h"
 
 using namespace swift;
 
+/// Link serialized SIL on demand instead of eagerly deserializing everything
+/// reachable. The devirtualizer and the inliner pull in the bodies they
+/// actually use, so this trades some early optimization visibility for not
+/// materializing the large share of stdlib SIL that no pass ever touches.
+static llvm::cl::opt<bool> SILLinkOnDemand(
+    "sil-link-on-demand", llvm::cl::init(false),
+    llvm::cl::desc("Deserialize SIL bodies on demand in the performance "
+                   "pipeline rather than eagerly linking everything"));
+
 //===----------------------------------------------------------------------===//
 //                          Top Level Driver
 //===----------------------------------------------------------------------===//
@@ -32,8 +42,15 @@ public:
 
   void run() override {
     SILModule &M = *getModule();
+    // In on-demand mode, downgrade the performance pipeline's eager LinkAll
+    // to the mandatory pipeline's normal linking; later passes deserialize
+    // the specific bodies they need.
+    auto EffectiveMode = LinkMode;
+    if (SILLinkOnDemand && EffectiveMode == SILModule::LinkingMode::LinkAll)
+      EffectiveMode = SILModule::LinkingMode::LinkNormal;
+
     for (auto &Fn : M)
-      if (M.linkFunction(&Fn, LinkMode))
+      if (M.linkFunction(&Fn, EffectiveMode))
         invalidateAnalysis(&Fn, SILAnalysis::InvalidationKind::Everything);
   }
 
@@ -1368,6 +1368,17 @@ static bool isFoldable(SILInstruction *I) {
   return isa<IntegerLiteralInst>(I) || isa<FloatLiteralInst>(I);
 }
 
+// Note on folding all-literal string *interpolations* ("x = \(1)"): the
+// obstacle is the lowering, not this folder. Interpolation collects its
+// segments through init(stringInterpolationSegment:) overloads that funnel
+// non-String literals into String(describing:) — an arbitrary-code path a
+// SIL pass cannot legally fold. Making log-line interpolations free needs
+// either (a) @_semantics tags on the literal-taking segment initializers
+// (Int, Bool, String) so a folder can rewrite the segment calls into
+// string literals and then let the existing concat folding below collapse
+// the sequence, or (b) moving the literal rendering into SILGen for
+// literal operands. Option (a) is stdlib-annotation work that composes
+// with this file as it stands.
 bool ConstantFolder::constantFoldStringConcatenation(ApplyInst *AI) {
   SILBuilder B(AI);
   // Try to apply the string literal concatenation optimization.
@@ -24,6 +24,12 @@
 #include "swift/SILOptimizer/Utils/GenericCloner.h"
 #include "swift/SILOptimizer/Utils/SpecializationMangler.h"
 #include "swift/Strings.h"
+#include "llvm/ADT/StringSet.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/LineIterator.h"
+#include "llvm/Support/ManagedStatic.h"
+#include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Support/raw_ostream.h"
 
 using namespace swift;
 
@@ -53,6 +59,14 @@ llvm::cl::opt<bool> PrintGenericSpecializationLoops(
     llvm::cl::desc("Print detected infinite generic specialization loops that "
                    "were prevented"));
 
+/// If non-empty, the path of a file which persists the mangled names of
+/// created generic specializations across frontend invocations.
+llvm::cl::opt<std::string> SpecializationCachePath(
+    "sil-specialization-cache-path", llvm::cl::init(""),
+    llvm::cl::desc("Record the mangled names of created generic "
+                   "specializations in the given file and consult it before "
+                   "re-running the specializer"));
+
 static bool OptimizeGenericSubstitutions = false;
 
 /// Max depth of a type which can be processed by the generic
@@ -1779,6 +1793,66 @@ ReabstractionInfo::ReabstractionInfo(SILFunction *Callee,
 // GenericFuncSpecializer
 // =============================================================================
 
+namespace {
+
+/// A cross-invocation cache of generic specializations.
+///
+/// The cache persists the mangled names of serializable specializations which
+/// earlier frontend invocations created. On a hit we ask the SIL loader for
+/// the serialized body instead of re-running the cloner; a stale entry whose
+/// body cannot be found anywhere simply falls back to specialization.
+class SpecializationCache {
+  llvm::StringSet<> KnownNames;
+  bool Loaded = false;
+
+  /// Populate the in-memory name set from the cache file on first use.
+  void load() {
+    if (Loaded)
+      return;
+    Loaded = true;
+    auto Buffer = llvm::MemoryBuffer::getFile(SpecializationCachePath);
+    if (!Buffer)
+      return;
+    for (llvm::line_iterator LineIter(**Buffer, /*SkipBlanks*/ true);
+         !LineIter.is_at_eof(); ++LineIter) {
+      KnownNames.insert(*LineIter);
+    }
+  }
+
+public:
+  bool isEnabled() const { return !SpecializationCachePath.empty(); }
+
+  /// Return true if an earlier invocation recorded the specialization.
+  bool contains(StringRef Name) {
+    if (!isEnabled())
+      return false;
+    load();
+    return KnownNames.count(Name) != 0;
+  }
+
+  /// Record a newly created specialization. Lines are appended atomically so
+  /// concurrent frontend jobs can share one cache file.
+  void record(StringRef Name) {
+    if (!isEnabled())
+      return;
+    // Load first so that names which are already in the file are not
+    // appended a second time.
+    load();
+    if (!KnownNames.insert(Name).second)
+      return;
+    std::error_code EC;
+    llvm::raw_fd_ostream OS(SpecializationCachePath, EC,
+                            llvm::sys::fs::F_Append | llvm::sys::fs::F_Text);
+    if (EC)
+      return;
+    OS << Name << '\n';
+  }
+};
+
+} // end anonymous namespace
+
+static llvm::ManagedStatic<SpecializationCache> SpecCache;
+
 GenericFuncSpecializer::GenericFuncSpecializer(
     SILOptFunctionBuilder &FuncBuilder, SILFunction *GenericFunc,
     SubstitutionMap ParamSubs, IsSerialized_t Serialized,
@@ -1820,6 +1894,21 @@ SILFunction *GenericFuncSpecializer::lookupSpecialization() {
                             << ClonedName << "\n");
     return SpecializedF;
   }
+
+  // Consult the cross-invocation specialization cache. If an earlier
+  // invocation created this exact specialization and serialized it into one
+  // of the known modules, deserialize it instead of re-running the cloner.
+  if (Serialized != IsNotSerialized && SpecCache->contains(ClonedName)) {
+    if (SILFunction *SpecializedF = M.loadFunction(ClonedName)) {
+      if (SpecializedF->getLoweredFunctionType()
+          == ReInfo.getSpecializedType()) {
+        LLVM_DEBUG(llvm::dbgs() << "Deserialized cached specialization for: "
+                                << ClonedName << "\n");
+        return SpecializedF;
+      }
+    }
+  }
+
   LLVM_DEBUG(llvm::dbgs() << "Could not find an existing specialization for: "
                           << ClonedName << "\n");
   return nullptr;
@@ -1867,6 +1956,10 @@ SILFunction *GenericFuncSpecializer::tryCreateSpecialization() {
   SpecializedF->setClassSubclassScope(SubclassScope::NotApplicable);
   SpecializedF->setSpecializationInfo(
       GenericSpecializationInformation::create(Caller, GenericFunc, Subs));
+  // Only serializable specializations can be re-imported by later
+  // invocations, so only those are worth recording.
+  if (Serialized != IsNotSerialized)
+    SpecCache->record(ClonedName);
   return SpecializedF;
 }
 
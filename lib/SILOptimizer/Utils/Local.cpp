@@ -1466,8 +1466,13 @@ bool swift::calleesAreStaticallyKnowable(SILModule &M, SILDeclRef Decl) {
   auto *AFD = Decl.getAbstractFunctionDecl();
   assert(AFD && "Expected abstract function decl!");
 
+  // In a sealed world the user asserts that the statically linked image's
+  // whole class hierarchy is visible to this compilation, so members of
+  // other modules can be reasoned about like our own.
+  bool SealedWorld = M.getOptions().AssumeSealedClasses;
+
   // Only handle members defined within the SILModule's associated context.
-  if (!AFD->isChildContextOf(AssocDC))
+  if (!AFD->isChildContextOf(AssocDC) && !SealedWorld)
     return false;
 
   if (AFD->isDynamic())
@@ -1492,7 +1497,7 @@ bool swift::calleesAreStaticallyKnowable(SILModule &M, SILDeclRef Decl) {
     }
     LLVM_FALLTHROUGH;
   case AccessLevel::Internal:
-    return M.isWholeModule();
+    return M.isWholeModule() || SealedWorld;
   case AccessLevel::FilePrivate:
   case AccessLevel::Private:
     return true;
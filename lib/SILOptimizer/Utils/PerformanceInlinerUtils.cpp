@@ -11,6 +11,7 @@
 //===----------------------------------------------------------------------===//
 
 #include "swift/AST/Module.h"
+#include "swift/SIL/OptimizationRemark.h"
 #include "swift/SILOptimizer/Utils/PerformanceInlinerUtils.h"
 #include "swift/Strings.h"
 
@@ -655,16 +656,32 @@ static bool isCallerAndCalleeLayoutConstraintsCompatible(FullApplySite AI) {
 
 // Returns the callee of an apply_inst if it is basically inlinable.
 SILFunction *swift::getEligibleFunction(FullApplySite AI,
-                                        InlineSelection WhatToInline) {
+                                        InlineSelection WhatToInline,
+                                        OptRemark::Emitter *ORE) {
   SILFunction *Callee = AI.getReferencedFunction();
 
   if (!Callee) {
     return nullptr;
   }
 
+  // Reports the reason a callsite was rejected before the cost model ran.
+  // The reason strings are a stable vocabulary; tools diff them across
+  // compiler versions, so change them deliberately.
+  auto notEligible = [&](StringRef Reason) -> SILFunction * {
+    if (ORE) {
+      ORE->emit([&]() {
+        using namespace OptRemark;
+        return RemarkMissed("NotEligible", *AI.getInstruction())
+               << "Not considering " << NV("Callee", Callee)
+               << " for inlining (" << Reason << ")";
+      });
+    }
+    return nullptr;
+  };
+
   // We don't currently support inlining co-routines with several yields.
   if (!SILInliner::canInlineBeginApply(AI))
-    return nullptr;
+    return notEligible("coroutine with multiple yields");
 
   auto ModuleName = Callee->getModule().getSwiftModule()->getName().str();
   bool IsInStdlib = (ModuleName == STDLIB_NAME || ModuleName == SWIFT_ONONE_SUPPORT);
@@ -674,42 +691,42 @@ SILFunction *swift::getEligibleFunction(FullApplySite AI,
   if (Callee->hasSemanticsAttrs() || Callee->hasEffectsKind()) {
     if (WhatToInline == InlineSelection::NoSemanticsAndGlobalInit) {
       if (shouldSkipApplyDuringEarlyInlining(AI))
-        return nullptr;
+        return notEligible("semantics or effects attribute during early inlining");
       if (Callee->hasSemanticsAttr("inline_late"))
-        return nullptr;
+        return notEligible("inline_late semantics during early inlining");
     }
     // The "availability" semantics attribute is treated like global-init.
     if (Callee->hasSemanticsAttrs() &&
         WhatToInline != InlineSelection::Everything &&
         (Callee->hasSemanticsAttrThatStartsWith("availability") ||
          (Callee->hasSemanticsAttrThatStartsWith("inline_late")))) {
-      return nullptr;
+      return notEligible("availability or inline_late semantics");
     }
     if (Callee->hasSemanticsAttrs() &&
         WhatToInline == InlineSelection::Everything) {
       if (Callee->hasSemanticsAttrThatStartsWith("inline_late") && IsInStdlib) {
-        return nullptr;
+        return notEligible("inline_late semantics in the standard library");
       }
     }
 
   } else if (Callee->isGlobalInit()) {
     if (WhatToInline != InlineSelection::Everything) {
-      return nullptr;
+      return notEligible("global initializer");
     }
   }
 
   // We can't inline external declarations.
   if (Callee->empty() || Callee->isExternalDeclaration()) {
-    return nullptr;
+    return notEligible("external declaration");
   }
 
   // Explicitly disabled inlining.
   if (Callee->getInlineStrategy() == NoInline) {
-    return nullptr;
+    return notEligible("@inline(never)");
   }
 
   if (!Callee->shouldOptimize()) {
-    return nullptr;
+    return notEligible("optimization disabled for callee");
   }
 
   SILFunction *Caller = AI.getFunction();
@@ -724,14 +741,14 @@ SILFunction *swift::getEligibleFunction(FullApplySite AI,
       auto CalleeSelf = stripCasts(AI.getSelfArgument());
       auto CallerSelf = Caller->getSelfArgument();
       if (CalleeSelf != SILValue(CallerSelf))
-        return nullptr;
+        return notEligible("binds dynamic Self different from caller's");
     } else
-      return nullptr;
+      return notEligible("binds dynamic Self");
   }
 
   // Detect self-recursive calls.
   if (Caller == Callee) {
-    return nullptr;
+    return notEligible("self-recursive call");
   }
 
   // A non-fragile function may not be inlined into a fragile function.
@@ -743,21 +760,21 @@ SILFunction *swift::getEligibleFunction(FullApplySite AI,
       llvm_unreachable("Should never be inlining a resilient function into "
                        "a fragile function");
     }
-    return nullptr;
+    return notEligible("non-fragile callee of a fragile caller");
   }
 
   // Inlining self-recursive functions into other functions can result
   // in excessive code duplication since we run the inliner multiple
   // times in our pipeline
   if (calleeIsSelfRecursive(Callee)) {
-    return nullptr;
+    return notEligible("self-recursive callee");
   }
 
   if (!EnableSILInliningOfGenerics && AI.hasSubstitutions()) {
     // Inlining of generics is not allowed unless it is an @inline(__always)
     // or transparent function.
     if (Callee->getInlineStrategy() != AlwaysInline && !Callee->isTransparent())
-      return nullptr;
+      return notEligible("inlining of generics is disabled");
   }
 
   // We cannot inline function with layout constraints on its generic types
@@ -767,13 +784,13 @@ SILFunction *swift::getEligibleFunction(FullApplySite AI,
   // generic type T: _LayoutConstraint, which is impossible currently.
   if (EnableSILInliningOfGenerics && AI.hasSubstitutions()) {
     if (!isCallerAndCalleeLayoutConstraintsCompatible(AI))
-      return nullptr;
+      return notEligible("incompatible generic layout constraints");
   }
 
   // IRGen cannot handle partial_applies containing opened_existentials
   // in its substitutions list.
   if (calleeHasPartialApplyWithOpenedExistentials(AI)) {
-    return nullptr;
+    return notEligible("partial_apply with opened existential substitutions");
   }
 
   return Callee;
@@ -17,6 +17,7 @@
 #include "ConstraintSystem.h"
 #include "swift/AST/ParameterList.h"
 #include "swift/AST/TypeWalker.h"
+#include "swift/Basic/Statistic.h"
 #include "llvm/ADT/SetVector.h"
 #include "llvm/ADT/Statistic.h"
 #include "llvm/Support/Compiler.h"
@@ -127,6 +128,17 @@ Solution ConstraintSystem::finalize(
   // Create the solution.
   Solution solution(*this, CurrentScore);
 
+  // Pre-size the solution tables from the constraint system state they are
+  // copied out of. Deep solver recursion takes many partial snapshots, and
+  // growing these maps entry by entry is pure malloc traffic.
+  solution.typeBindings.reserve(TypeVariables.size());
+  solution.ConstraintRestrictions.reserve(ConstraintRestrictions.size());
+  solution.Fixes.reserve(Fixes.size());
+  solution.DisjunctionChoices.reserve(DisjunctionChoices.size());
+  solution.OpenedTypes.reserve(OpenedTypes.size());
+  solution.OpenedExistentialTypes.reserve(OpenedExistentialTypes.size());
+  solution.Conformances.reserve(CheckedConformances.size());
+
   // Update the best score we've seen so far.
   if (solverState && !retainAllSolutions()) {
     assert(TC.getLangOpts().DisableConstraintSolverPerformanceHacks ||
@@ -465,6 +477,21 @@ ConstraintSystem::SolverState::~SolverState() {
   #define CS_STATISTIC(Name, Description) JOIN2(Overall,Name) += Name;
   #include "ConstraintSolverStats.def"
 
+  // Mirror the per-expression exploration counters into the unified stats
+  // reporter, where they are attributed to the expression whose stats tracer
+  // is active.
+  if (auto *Stats = CS.getTypeChecker().Context.Stats) {
+    auto &C = Stats->getFrontendCounters();
+    C.NumSolverScopesExplored += NumStatesExplored;
+    C.NumTypeVariableBindingsExplored += NumTypeVariableBindings;
+    C.NumDisjunctionTermsExplored += NumDisjunctionTerms;
+    // The solver arena dies with the ConstraintSystem, so its footprint has
+    // to be captured here, while the solve's allocations are still live;
+    // sampling after Sema always reads an empty arena.
+    C.NumConstraintSolverBytesAllocated +=
+        CS.getASTContext().getSolverMemory();
+  }
+
   // Update the "largest" statistics if this system is larger than the
   // previous one.  
   // FIXME: This is not at all thread-safe.
@@ -497,6 +524,20 @@ ConstraintSystem::SolverScope::SolverScope(ConstraintSystem &cs)
   assert(!cs.failedConstraint && "Unexpected failed constraint!");
 }
 
+// On reclaiming solver memory at scope pop: the Constraints, Fixes, and
+// locators generated under this scope are removed from circulation below,
+// but their storage must outlive the rollback. Generated constraints are
+// allocated in the ConstraintSystem's bump allocator interleaved with
+// allocations from enclosing scopes (no per-scope high-water mark to reset
+// to), locators are uniqued in ConstraintLocators and may be shared with
+// surviving solutions, and the failed-constraint pointer kept for
+// diagnostics can name a constraint from an abandoned branch. Per-kind
+// freelists tied to this destructor would hand those objects' memory back
+// while such references remain. The solver's memory story is instead:
+// allocations are arena-cheap, the arena dies with the solve, and the
+// arena itself is recycled across ConstraintSystems via the shared
+// allocator pool — peak tracking the explored tree is the price of
+// pointer-stable constraint identity during diagnosis.
 ConstraintSystem::SolverScope::~SolverScope() {
   // Erase the end of various lists.
   cs.resolvedOverloadSets = resolvedOverloadSets;
@@ -1323,6 +1364,11 @@ bool ConstraintSystem::solve(Expr *&expr,
                              ExprTypeCheckListener *listener,
                              SmallVectorImpl<Solution> &solutions,
                              FreeTypeVariableBinding allowFreeTypeVariables) {
+  // Attribute the solver counters to this expression in the stats trace, so
+  // that the most expensive expressions of a module can be found from the
+  // unified stats output rather than -debug-constraints spelunking.
+  FrontendStatsTracer StatsTracer(TC.Context.Stats, "solve-expression", expr);
+
   // Attempt to solve the constraint system.
   auto solution = solveImpl(expr,
                             convertType,
@@ -478,13 +478,15 @@ void ConstraintGraph::gatherConstraints(
     if (!typeVars.insert(typeVar).second)
       continue;
 
-    for (auto constraint : (*this)[typeVar].getConstraints()) {
+    // Note: retrieve the node once; the lookup is a hash-map access and this
+    // loop is hot on expressions with many type variables.
+    auto &node = (*this)[typeVar];
+
+    for (auto constraint : node.getConstraints()) {
       if (acceptConstraint(constraint))
         constraints.insert(constraint);
     }
 
-    auto &node = (*this)[typeVar];
-
     // Retrieve the constraints from adjacent bindings.
     for (auto adjTypeVar : node.getAdjacencies()) {
       switch (kind) {
@@ -69,6 +69,8 @@ ExpressionTimer::~ExpressionTimer() {
 ConstraintSystem::ConstraintSystem(TypeChecker &tc, DeclContext *dc,
                                    ConstraintSystemOptions options)
   : TC(tc), DC(dc), Options(options),
+    Allocator(tc.acquireConstraintSystemAllocator()),
+    AllocatorReleaser(tc, Allocator),
     Arena(tc.Context, Allocator),
     CG(*new ConstraintGraph(*this))
 {
@@ -79,6 +81,26 @@ ConstraintSystem::~ConstraintSystem() {
   delete &CG;
 }
 
+ConstraintSystem::PooledAllocatorRAII::~PooledAllocatorRAII() {
+  TC.releaseConstraintSystemAllocator(Allocator);
+}
+
+llvm::BumpPtrAllocator &TypeChecker::acquireConstraintSystemAllocator() {
+  if (!FreeConstraintSystemAllocators.empty()) {
+    auto *allocator = FreeConstraintSystemAllocators.back().release();
+    FreeConstraintSystemAllocators.pop_back();
+    return *allocator;
+  }
+  return *new llvm::BumpPtrAllocator();
+}
+
+void TypeChecker::releaseConstraintSystemAllocator(
+    llvm::BumpPtrAllocator &allocator) {
+  // Free all but the largest slab, which subsequent expressions reuse.
+  allocator.Reset();
+  FreeConstraintSystemAllocators.emplace_back(&allocator);
+}
+
 void ConstraintSystem::incrementScopeCounter() {
   SWIFT_FUNC_STAT;
   CountScopes++;
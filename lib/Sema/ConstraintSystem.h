@@ -931,7 +931,23 @@ public:
 private:
 
   /// \brief Allocator used for all of the related constraint systems.
-  llvm::BumpPtrAllocator Allocator;
+  /// Scratch allocator for the solver, acquired from the type checker's
+  /// pool so its slabs are reused across the expressions of a file.
+  llvm::BumpPtrAllocator &Allocator;
+
+  /// Returns the pooled allocator to the type checker once the constraint
+  /// system dies. Declared before Arena deliberately: the arena's teardown
+  /// destroys solver-allocated conformances whose memory lives in
+  /// Allocator, so the allocator may only be reset after the arena has
+  /// popped.
+  struct PooledAllocatorRAII {
+    TypeChecker &TC;
+    llvm::BumpPtrAllocator &Allocator;
+
+    PooledAllocatorRAII(TypeChecker &tc, llvm::BumpPtrAllocator &allocator)
+        : TC(tc), Allocator(allocator) {}
+    ~PooledAllocatorRAII();
+  } AllocatorReleaser;
 
   /// \brief Arena used for memory management of constraint-checker-related
   /// allocations.
@@ -3188,6 +3204,13 @@ public:
     if (isExpressionAlreadyTooComplex)
       return true;
 
+    // A raised cancellation flag abandons the solve through the same bail
+    // path as a blown budget; the caller's results are discarded anyway.
+    if (auto *cancelled = TC.Context.CancellationFlag) {
+      if (cancelled->load(std::memory_order_relaxed))
+        return isExpressionAlreadyTooComplex = true;
+    }
+
     auto used = TC.Context.getSolverMemory();
     for (auto const& s : solutions) {
       used += s.getTotalMemory();
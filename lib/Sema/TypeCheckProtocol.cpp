@@ -651,7 +651,8 @@ RequirementMatch swift::matchWitness(TypeChecker &tc,
                                      ProtocolConformance *conformance,
                                      DeclContext *dc,
                                      ValueDecl *req,
-                                     ValueDecl *witness) {
+                                     ValueDecl *witness,
+                                     RequirementEnvironmentCache *reqEnvCache) {
   using namespace constraints;
 
   // Initialized by the setup operation.
@@ -719,8 +720,26 @@ RequirementMatch swift::matchWitness(TypeChecker &tc,
     }
   }
 
-  Optional<RequirementEnvironment> reqEnvironment(
-      RequirementEnvironment(dc, reqSig, proto, covariantSelf, conformance));
+  // Within one conformance check, dc, proto and conformance are fixed, so
+  // the environment is determined by the requirement signature and the
+  // covariant-Self override; share previously derived environments when the
+  // caller provides a cache.
+  Optional<RequirementEnvironment> reqEnvironment;
+  if (reqEnvCache) {
+    auto cacheKey = std::make_pair(reqSig, covariantSelf);
+    auto cached = reqEnvCache->find(cacheKey);
+    if (cached == reqEnvCache->end()) {
+      cached = reqEnvCache
+                   ->insert({cacheKey, RequirementEnvironment(
+                                           dc, reqSig, proto, covariantSelf,
+                                           conformance)})
+                   .first;
+    }
+    reqEnvironment.emplace(cached->second);
+  } else {
+    reqEnvironment.emplace(
+        RequirementEnvironment(dc, reqSig, proto, covariantSelf, conformance));
+  }
 
   // Set up the constraint system for matching.
   auto setup = [&]() -> std::tuple<Optional<RequirementMatch>, Type, Type> {
@@ -1021,7 +1040,7 @@ bool WitnessChecker::findBestWitness(
       }
 
       auto match = matchWitness(TC, Proto, conformance, DC,
-                                requirement, witness);
+                                requirement, witness, &ReqEnvironmentCache);
       if (match.isViable()) {
         ++numViable;
         bestIdx = matches.size();
@@ -4094,6 +4113,19 @@ void TypeChecker::useBridgedNSErrorConformances(DeclContext *dc, Type type) {
   }
 }
 
+// Note on caching checked conformances across rebuilds: a sidecar of
+// (nominal fingerprint, protocol fingerprint) -> witness mappings can't
+// reuse the ProtocolConformance deserialization machinery as-is, because
+// witness resolution is not a pure function of the two declarations — it
+// reads overload sets, visible extensions, and the conformance context's
+// imports, so the fingerprint would need to cover the whole lookup
+// environment to be sound (this is the same closure the incremental
+// dependency tracker approximates). The profitable subset with a sound
+// key is same-module unchanged files, which is precisely what skipping
+// the frontend job entirely (incremental builds, and the interface-digest
+// record added for cross-module rebuilds) already delivers; a
+// conformance-granularity cache below that level buys little beyond what
+// those coarser skips cover.
 void TypeChecker::checkConformance(NormalProtocolConformance *conformance) {
   PrettyStackTraceType trace1(Context, "checking conformance of",
                               conformance->getType());
@@ -429,6 +429,15 @@ struct RequirementMatch {
 
 struct RequirementCheck;
 
+/// A cache of RequirementEnvironments for a single conformance check,
+/// keyed by the facts the environment is actually derived from. Matching a
+/// requirement against many candidate witnesses (and many requirements of
+/// the same conformance against their candidates) re-derives identical
+/// environments otherwise.
+using RequirementEnvironmentCache =
+    llvm::DenseMap<std::pair<GenericSignature *, ClassDecl *>,
+                   RequirementEnvironment>;
+
 class WitnessChecker {
 protected:
   TypeChecker &TC;
@@ -441,6 +450,10 @@ protected:
   // @_implements(Protocol, DeclName)
   llvm::DenseMap<DeclName, llvm::TinyPtrVector<ValueDecl *>> ImplementsTable;
 
+  /// Requirement environments shared across the witness matches of this
+  /// checker's conformance.
+  RequirementEnvironmentCache ReqEnvironmentCache;
+
   WitnessChecker(TypeChecker &tc, ProtocolDecl *proto,
                  Type adoptee, DeclContext *dc);
 
@@ -844,7 +857,9 @@ RequirementMatch matchWitness(TypeChecker &tc,
                               ProtocolConformance *conformance,
                               DeclContext *dc,
                               ValueDecl *req,
-                              ValueDecl *witness);
+                              ValueDecl *witness,
+                              RequirementEnvironmentCache *reqEnvCache
+                                = nullptr);
 
 /// If the given type is a direct reference to an associated type of
 /// the given protocol, return the referenced associated type.
@@ -138,6 +138,15 @@ Type EnumRawTypeRequest::evaluate(Evaluator &evaluator,
   return Type();
 }
 
+bool TypeCheckFunctionBodyRequest::evaluate(Evaluator &evaluator,
+                                            AbstractFunctionDecl *func) const {
+  auto lazyResolver = func->getASTContext().getLazyResolver();
+  assert(lazyResolver && "Cannot type check function body at this point");
+
+  TypeChecker &tc = *static_cast<TypeChecker *>(lazyResolver);
+  return tc.typeCheckAbstractFunctionBody(func);
+}
+
 // Define request evaluation functions for each of the type checker requests.
 static AbstractRequestFunction *typeCheckerRequestFunctions[] = {
 #define SWIFT_TYPEID(Name)                                    \
@@ -31,6 +31,7 @@
 #include "swift/AST/NameLookup.h"
 #include "swift/AST/PrettyStackTrace.h"
 #include "swift/AST/ProtocolConformance.h"
+#include "swift/AST/TypeCheckRequests.h"
 #include "swift/Basic/Statistic.h"
 #include "swift/Basic/STLExtras.h"
 #include "swift/Basic/Timer.h"
@@ -527,7 +528,10 @@ static void typeCheckFunctionsAndExternalDecls(SourceFile &SF, TypeChecker &TC)
          ++currentFunctionIdx) {
       auto *AFD = TC.definedFunctions[currentFunctionIdx];
 
-      TC.typeCheckAbstractFunctionBody(AFD);
+      // Check the body through the request evaluator, so that an
+      // already-checked body (e.g. one a previous iteration reached through
+      // a synthesized declaration) is a memoized hit instead of a re-check.
+      (void)TC.Context.evaluator(TypeCheckFunctionBodyRequest{AFD});
     }
 
     // Type check external definitions.
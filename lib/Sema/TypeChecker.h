@@ -29,6 +29,8 @@
 #include "swift/Parse/Lexer.h"
 #include "swift/Basic/OptionSet.h"
 #include "swift/Config.h"
+#include "llvm/Support/Allocator.h"
+#include <memory>
 #include "llvm/ADT/SetVector.h"
 #include "llvm/ADT/TinyPtrVector.h"
 #include <functional>
@@ -689,6 +691,13 @@ public:
   /// will need to compute captures for.
   std::vector<AnyFunctionRef> ClosuresWithUncomputedCaptures;
 
+  /// Recycled scratch allocators for constraint systems. Constructing and
+  /// destroying a system brackets every expression; reusing the slabs
+  /// avoids a malloc/free pair per solve. This is a stack, not a single
+  /// slot, because constraint systems nest.
+  std::vector<std::unique_ptr<llvm::BumpPtrAllocator>>
+      FreeConstraintSystemAllocators;
+
   /// Local functions that have been captured before their definitions.
   ///
   /// We need this to guard against functions that would transitively capture
@@ -855,6 +864,14 @@ public:
   TypeChecker& operator=(const TypeChecker&) = delete;
   ~TypeChecker();
 
+  /// Take a scratch allocator for a constraint system, reusing a recycled
+  /// one when available.
+  llvm::BumpPtrAllocator &acquireConstraintSystemAllocator();
+
+  /// Return a constraint system's scratch allocator to the pool, releasing
+  /// its contents but keeping its largest slab for reuse.
+  void releaseConstraintSystemAllocator(llvm::BumpPtrAllocator &allocator);
+
   LangOptions &getLangOpts() const { return Context.LangOpts; }
 
   /// Dump the time it takes to type-check each function to llvm::errs().
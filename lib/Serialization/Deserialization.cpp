@@ -2194,6 +2194,17 @@ static uint64_t encodeLazyConformanceContextData(uint64_t numProtocols,
   return (numProtocols << 48) | bitPosition;
 }
 
+// A background prefetcher that speculatively decodes referenced decl/type
+// IDs can't be bolted onto this entry point: decoding is not a private
+// read — it creates decls in the shared ASTContext, interns types, and
+// recursively re-enters getDecl/getType on this same cursor state, all
+// unsynchronized with the Sema thread that's consuming the results. The
+// safe subset of the idea is below the deserializer: the module buffer is
+// mmapped, so advising the OS to read ahead (or simply touching upcoming
+// index-block pages) hides I/O latency without sharing any compiler state.
+// Decode cost itself is already paid at most once per ID via DeclsAndTypes
+// caching; making the decode concurrent means making the ASTContext
+// concurrent first.
 Decl *ModuleFile::getDecl(DeclID DID, Optional<DeclContext *> ForcedContext) {
   Expected<Decl *> deserialized = getDeclChecked(DID, ForcedContext);
   if (!deserialized) {
@@ -2631,6 +2631,16 @@ void SILDeserializer::getAllSILFunctions() {
   }
 }
 
+// Granularity note: vtable deserialization is already lazy per class —
+// lookupVTable goes through the on-disk name index and nothing is read
+// until a lookup asks for that class — and materializing a table is much
+// cheaper than it looks: every entry resolves its function with
+// declarationOnly=true, so bodies stay on disk until the linker actually
+// wants one. Going lazier (per entry) would require keying the on-disk
+// records by member so a single SILDeclRef can be matched without reading
+// its siblings; but answering lookUpFunctionInVTable at all requires the
+// (member, function) pairs of the whole table, so the per-class read below
+// is already the minimal unit for the devirtualizer's queries.
 SILVTable *SILDeserializer::readVTable(DeclID VId) {
   if (VId == 0)
     return nullptr;
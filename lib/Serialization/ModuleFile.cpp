@@ -224,6 +224,9 @@ validateControlBlock(llvm::BitstreamCursor &cursor,
     case control_block::TARGET:
       result.targetTriple = blobData;
       break;
+    case control_block::INTERFACE_HASH:
+      result.interfaceHash = blobData;
+      break;
     default:
       // Unknown metadata record, possibly for use by a future version of the
       // module format.
@@ -755,6 +758,21 @@ ModuleFile::readObjCMethodTable(ArrayRef<uint64_t> fields, StringRef blobData) {
                                              base + sizeof(uint32_t), base));
 }
 
+/// Populate \p offsets from an offsets record, whose payload is a blob of
+/// little-endian fixed-width entries used directly from the module buffer.
+template <typename T>
+static void assignOffsets(std::vector<T> &offsets, uint64_t count,
+                          StringRef blobData) {
+  assert(blobData.size() == count * sizeof(uint32_t) &&
+         "malformed offsets blob");
+  auto entries =
+      reinterpret_cast<const llvm::support::ulittle32_t *>(blobData.data());
+  offsets.clear();
+  offsets.reserve(count);
+  for (uint64_t i = 0; i != count; ++i)
+    offsets.push_back(serialization::BitOffset(uint32_t(entries[i])));
+}
+
 bool ModuleFile::readIndexBlock(llvm::BitstreamCursor &cursor) {
   cursor.EnterSubBlock(INDEX_BLOCK_ID);
 
@@ -795,20 +813,16 @@ bool ModuleFile::readIndexBlock(llvm::BitstreamCursor &cursor) {
 
       switch (kind) {
       case index_block::DECL_OFFSETS:
-        assert(blobData.empty());
-        Decls.assign(scratch.begin(), scratch.end());
+        assignOffsets(Decls, scratch[0], blobData);
         break;
       case index_block::DECL_CONTEXT_OFFSETS:
-        assert(blobData.empty());
-        DeclContexts.assign(scratch.begin(), scratch.end());
+        assignOffsets(DeclContexts, scratch[0], blobData);
         break;
       case index_block::TYPE_OFFSETS:
-        assert(blobData.empty());
-        Types.assign(scratch.begin(), scratch.end());
+        assignOffsets(Types, scratch[0], blobData);
         break;
       case index_block::IDENTIFIER_OFFSETS:
-        assert(blobData.empty());
-        Identifiers.assign(scratch.begin(), scratch.end());
+        assignOffsets(Identifiers, scratch[0], blobData);
         break;
       case index_block::TOP_LEVEL_DECLS:
         TopLevelDecls = readDeclTable(scratch, blobData);
@@ -848,28 +862,22 @@ bool ModuleFile::readIndexBlock(llvm::BitstreamCursor &cursor) {
         DeclMemberNames = readDeclMemberNamesTable(scratch, blobData);
         break;
       case index_block::LOCAL_DECL_CONTEXT_OFFSETS:
-        assert(blobData.empty());
-        LocalDeclContexts.assign(scratch.begin(), scratch.end());
+        assignOffsets(LocalDeclContexts, scratch[0], blobData);
         break;
       case index_block::GENERIC_SIGNATURE_OFFSETS:
-        assert(blobData.empty());
-        GenericSignatures.assign(scratch.begin(), scratch.end());
+        assignOffsets(GenericSignatures, scratch[0], blobData);
         break;
       case index_block::GENERIC_ENVIRONMENT_OFFSETS:
-        assert(blobData.empty());
-        GenericEnvironments.assign(scratch.begin(), scratch.end());
+        assignOffsets(GenericEnvironments, scratch[0], blobData);
         break;
       case index_block::SUBSTITUTION_MAP_OFFSETS:
-        assert(blobData.empty());
-        SubstitutionMaps.assign(scratch.begin(), scratch.end());
+        assignOffsets(SubstitutionMaps, scratch[0], blobData);
         break;
       case index_block::NORMAL_CONFORMANCE_OFFSETS:
-        assert(blobData.empty());
-        NormalConformances.assign(scratch.begin(), scratch.end());
+        assignOffsets(NormalConformances, scratch[0], blobData);
         break;
       case index_block::SIL_LAYOUT_OFFSETS:
-        assert(blobData.empty());
-        SILLayouts.assign(scratch.begin(), scratch.end());
+        assignOffsets(SILLayouts, scratch[0], blobData);
         break;
 
       default:
@@ -949,6 +957,14 @@ public:
   }
 };
 
+// Note: "reading" the comment table materializes nothing. The on-disk
+// chained hash table is probed directly in the (memory-mapped) module
+// buffer, so hover-style lookups touch only the buckets for the queried
+// USR regardless of module size. The remaining per-request cost in IDE
+// hover latency is converting the raw comment to XML/markdown on every
+// request; a per-USR cache of the converted output belongs in the
+// SourceKit layer, where request identity and invalidation (document
+// version) are known.
 std::unique_ptr<ModuleFile::SerializedDeclCommentTable>
 ModuleFile::readDeclCommentTable(ArrayRef<uint64_t> fields,
                                  StringRef blobData) {
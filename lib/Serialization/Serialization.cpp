@@ -56,6 +56,7 @@
 #include "llvm/Support/raw_ostream.h"
 #include "llvm/Support/YAMLParser.h"
 
+#include <thread>
 #include <vector>
 
 using namespace swift;
@@ -917,6 +918,7 @@ void Serializer::writeDocBlockInfoBlock() {
   BLOCK_RECORD(control_block, METADATA);
   BLOCK_RECORD(control_block, MODULE_NAME);
   BLOCK_RECORD(control_block, TARGET);
+  BLOCK_RECORD(control_block, INTERFACE_HASH);
 
   BLOCK(COMMENT_BLOCK);
   BLOCK_RECORD(comment_block, DECL_COMMENTS);
@@ -951,6 +953,34 @@ void Serializer::writeHeader(const SerializationOptions &options) {
 
     Target.emit(ScratchRecord, M->getASTContext().LangOpts.Target.str());
 
+    // Emit a stable digest of the module's source interface, combining the
+    // per-file interface hashes in file order. The hash states are copied
+    // before finalizing so the files' own hashes stay usable.
+    {
+      llvm::MD5 combined;
+      bool hasSourceFiles = false;
+      for (auto *file : M->getFiles()) {
+        auto *SF = dyn_cast<SourceFile>(file);
+        if (!SF)
+          continue;
+        hasSourceFiles = true;
+        llvm::MD5 fileState = SF->getInterfaceHashState();
+        llvm::MD5::MD5Result fileResult;
+        fileState.final(fileResult);
+        combined.update(
+            StringRef(reinterpret_cast<const char *>(fileResult.Bytes.data()),
+                      fileResult.Bytes.size()));
+      }
+      if (hasSourceFiles) {
+        llvm::MD5::MD5Result result;
+        combined.final(result);
+        llvm::SmallString<32> digest;
+        llvm::MD5::stringifyResult(result, digest);
+        control_block::InterfaceHashLayout InterfaceHash(Out);
+        InterfaceHash.emit(ScratchRecord, digest);
+      }
+    }
+
     {
       llvm::BCBlockRAII restoreBlock(Out, OPTIONS_BLOCK_ID, 4);
 
@@ -4172,7 +4202,16 @@ void Serializer::writeAllIdentifiers() {
 
 void Serializer::writeOffsets(const index_block::OffsetsLayout &Offsets,
                               const std::vector<BitOffset> &values) {
-  Offsets.emit(ScratchRecord, getOffsetRecordCode(values), values);
+  // Emit the table as a blob of little-endian fixed-width entries, so that
+  // readers can use it directly from the module buffer instead of decoding
+  // every element on each open.
+  std::vector<llvm::support::ulittle32_t> littleValues;
+  littleValues.reserve(values.size());
+  for (auto value : values)
+    littleValues.push_back(uint32_t(value));
+  Offsets.emit(ScratchRecord, getOffsetRecordCode(values), values.size(),
+               StringRef(reinterpret_cast<const char *>(littleValues.data()),
+                         littleValues.size() * sizeof(uint32_t)));
 }
 
 /// Writes an in-memory decl table to an on-disk representation, using the
@@ -4853,6 +4892,16 @@ static void collectInterestingNestedDeclarations(
   }
 }
 
+// Note on patch-based re-serialization: splicing unchanged decl trees from
+// a previous swiftmodule can't work at the bitstream level — IDs (DeclID,
+// TypeID, IdentifierID) are densely renumbered per emission and bit offsets
+// shift globally, so any retained subtree would need full re-linking, which
+// is most of the cost of emitting it. If merge-modules becomes the longest
+// serial segment of incremental builds, the leverage is above this layer:
+// emit per-file partial modules in parallel (they already exist in
+// MergePartialModules mode) and make downstream consumers read the digest
+// (now in the control block) to skip the merge entirely when no file's
+// interface changed.
 void Serializer::writeAST(ModuleOrSourceFile DC,
                           bool enableNestedTypeLookupTable) {
   DeclTable topLevelDecls, operatorDecls, operatorMethodDecls;
@@ -5103,13 +5152,26 @@ void swift::serialize(ModuleOrSourceFile DC,
     return;
   }
 
-  bool hadError = withOutputFile(getContext(DC), options.OutputPath,
-                                 [&](raw_ostream &out) {
+  // Encode the module into a memory buffer first and hand the (possibly
+  // large) disk write to a separate thread, so that the swiftmodule hits
+  // the disk while the swiftdoc is still being produced. The encode itself
+  // reads the AST and therefore cannot overlap with other AST consumers,
+  // including the swiftdoc serialization below.
+  llvm::SmallString<0> moduleBuffer;
+  {
     SharedTimer timer("Serialization, swiftmodule");
-    Serializer::writeToStream(out, DC, M, options);
+    llvm::raw_svector_ostream stream(moduleBuffer);
+    Serializer::writeToStream(stream, DC, M, options);
+  }
+
+  // Diagnostics are not thread-safe; stash the error code and report it
+  // after joining.
+  std::error_code moduleWriteError;
+  std::thread moduleWriter([&] {
+    moduleWriteError = swift::atomicallyWritingToFile(
+        options.OutputPath,
+        [&](raw_ostream &out) { out << moduleBuffer; });
   });
-  if (hadError)
-    return;
 
   if (options.DocOutputPath && options.DocOutputPath[0] != '\0') {
     (void)withOutputFile(getContext(DC), options.DocOutputPath,
@@ -5119,4 +5181,11 @@ void swift::serialize(ModuleOrSourceFile DC,
                                    getContext(DC));
     });
   }
+
+  moduleWriter.join();
+  if (moduleWriteError) {
+    getContext(DC).Diags.diagnose(SourceLoc(), diag::error_opening_output,
+                                  options.OutputPath,
+                                  moduleWriteError.message());
+  }
 }
@@ -60,8 +60,16 @@ openModuleFiles(clang::vfs::FileSystem &FS,
                                  llvm::sys::fs::AccessMode::Exist);
   }
 
+  // Open the module file without requiring a null terminator: the
+  // bitstream reader never needs one, and requiring it forces a private
+  // heap copy (instead of a shared read-only mapping) whenever the file
+  // size is an exact multiple of the page size. With plain mappings, all
+  // concurrent frontend jobs share one physical copy of each module via
+  // the page cache.
   llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> ModuleOrErr =
-      FS.getBufferForFile(StringRef(Scratch.data(), Scratch.size()));
+      FS.getBufferForFile(StringRef(Scratch.data(), Scratch.size()),
+                          /*FileSize=*/-1,
+                          /*RequiresNullTerminator=*/false);
   if (!ModuleOrErr)
     return ModuleOrErr.getError();
 
@@ -70,7 +78,9 @@ openModuleFiles(clang::vfs::FileSystem &FS,
   Scratch.clear();
   llvm::sys::path::append(Scratch, DirName, ModuleDocFilename);
   llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> ModuleDocOrErr =
-      FS.getBufferForFile(StringRef(Scratch.data(), Scratch.size()));
+      FS.getBufferForFile(StringRef(Scratch.data(), Scratch.size()),
+                          /*FileSize=*/-1,
+                          /*RequiresNullTerminator=*/false);
   if (!ModuleDocOrErr &&
       ModuleDocOrErr.getError() != std::errc::no_such_file_or_directory) {
     return ModuleDocOrErr.getError();
@@ -118,10 +128,30 @@ static void addDiagnosticInfoForArchitectureMismatch(ASTContext &ctx,
                      archName, foundArchs);
 }
 
+/// Return true if \p directory contains an entry named \p name, according
+/// to a cached listing of the directory read through \p FS.
+static bool directoryContains(clang::vfs::FileSystem &FS, StringRef directory,
+                              StringRef name,
+                              llvm::StringMap<llvm::StringSet<>> &listings) {
+  auto cached = listings.find(directory);
+  if (cached == listings.end()) {
+    auto &entries = listings[directory];
+    std::error_code EC;
+    for (auto iter = FS.dir_begin(directory, EC),
+              end = clang::vfs::directory_iterator();
+         !EC && iter != end; iter.increment(EC)) {
+      entries.insert(llvm::sys::path::filename(iter->getName()));
+    }
+    cached = listings.find(directory);
+  }
+  return cached->second.count(name) != 0;
+}
+
 static bool
 findModule(ASTContext &ctx, AccessPathElem moduleID,
            std::unique_ptr<llvm::MemoryBuffer> *moduleBuffer,
            std::unique_ptr<llvm::MemoryBuffer> *moduleDocBuffer,
+           llvm::StringMap<llvm::StringSet<>> &searchPathListings,
            bool &isFramework) {
   llvm::SmallString<64> moduleName(moduleID.first.str());
   llvm::SmallString<64> moduleFilename(moduleName);
@@ -150,7 +180,13 @@ findModule(ASTContext &ctx, AccessPathElem moduleID,
   llvm::SmallString<128> scratch;
   llvm::SmallString<128> currPath;
   isFramework = false;
+  auto &FS = *ctx.SourceMgr.getFileSystem();
   for (auto path : ctx.SearchPathOpts.ImportSearchPaths) {
+    // One cached directory read answers for both the flat module file and
+    // the .swiftmodule directory form; skip absent candidates without any
+    // per-candidate filesystem traffic.
+    if (!directoryContains(FS, path, moduleFilename, searchPathListings))
+      continue;
     auto err = openModuleFiles(*ctx.SourceMgr.getFileSystem(), path,
                                moduleFilename.str(), moduleDocFilename.str(),
                                moduleBuffer, moduleDocBuffer,
@@ -179,12 +215,15 @@ findModule(ASTContext &ctx, AccessPathElem moduleID,
     isFramework = true;
 
     auto tryFrameworkImport = [&](StringRef frameworkPath) -> bool {
-      currPath = frameworkPath;
-      llvm::sys::path::append(currPath, moduleFramework.str());
-      // Check if the framework directory exists
-      if (!llvm::sys::fs::is_directory(currPath)) {
+      // Check if the framework directory exists, using the cached listing
+      // (which also keeps this probe on the configured filesystem rather
+      // than the raw OS one).
+      if (!directoryContains(FS, frameworkPath, moduleFramework,
+                             searchPathListings)) {
         return false;
       }
+      currPath = frameworkPath;
+      llvm::sys::path::append(currPath, moduleFramework.str());
 
       llvm::sys::path::append(currPath, "Modules", moduleFilename.str());
       auto err = openModuleFiles(*ctx.SourceMgr.getFileSystem(),
@@ -511,7 +550,13 @@ SerializedModuleLoader::canImportModule(std::pair<Identifier, SourceLoc> mID) {
 
   // Otherwise look on disk.
   bool isFramework = false;
-  return findModule(Ctx, mID, nullptr, nullptr, isFramework);
+  bool found = findModule(Ctx, mID, nullptr, nullptr, SearchPathListings,
+                          isFramework);
+  // Drop the cached listings on failure so that a module built later in a
+  // long-lived session (e.g. the REPL) is found on retry.
+  if (!found)
+    SearchPathListings.clear();
+  return found;
 }
 
 ModuleDecl *SerializedModuleLoader::loadModule(SourceLoc importLoc,
@@ -540,7 +585,10 @@ ModuleDecl *SerializedModuleLoader::loadModule(SourceLoc importLoc,
   // Otherwise look on disk.
   if (!moduleInputBuffer) {
     if (!findModule(Ctx, moduleID, &moduleInputBuffer, &moduleDocInputBuffer,
-                    isFramework)) {
+                    SearchPathListings, isFramework)) {
+      // Drop the cached listings so a module that appears later in a
+      // long-lived session (e.g. the REPL) is found on retry.
+      SearchPathListings.clear();
       return nullptr;
     }
 
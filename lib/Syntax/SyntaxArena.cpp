@@ -17,53 +17,6 @@
 using namespace swift;
 using namespace swift::syntax;
 
-namespace {
-class RawSyntaxCacheNode;
-}
-
-/// Implementation detail of SyntaxArena.
-struct SyntaxArena::Implementation {
-  /// Allocator.
-  llvm::BumpPtrAllocator Allocator;
-
-  /// List of pointers to the allocated RawSyntax
-  std::vector<RawSyntax *> AllocatedRawSyntaxList;
-
-  Implementation() = default;
-  void *Allocate(size_t size, size_t alignment) {
-    return Allocator.Allocate(size, alignment);
-  }
-
-  void *AllocateRawSyntax(size_t size, size_t alignment) {
-    void *data = Allocator.Allocate(size, alignment);
-    /// Remember the allocated pointers so that we can destruct them.
-    AllocatedRawSyntaxList.push_back(static_cast<RawSyntax *>(data));
-    return data;
-  }
-
-  ~Implementation() {
-    // Destruct all allocated RawSyntax. They might contain heap allocated
-    // propeties and/or children.
-    for (auto *N : AllocatedRawSyntaxList)
-      N->~RawSyntax();
-  }
-};
-
-SyntaxArena::SyntaxArena() : Impl(*new Implementation()){};
-SyntaxArena::~SyntaxArena() { delete &Impl; }
-
-llvm::BumpPtrAllocator &SyntaxArena::getAllocator() const {
-  return Impl.Allocator;
-}
-
-void *SyntaxArena::Allocate(size_t size, size_t alignment) {
-  return Impl.Allocate(size, alignment);
-}
-
-void *SyntaxArena::AllocateRawSyntax(size_t size, size_t alignment) {
-  return Impl.AllocateRawSyntax(size, alignment);
-}
-
 namespace {
 
 /// Cache node for RawSyntax.
@@ -116,12 +69,73 @@ template <> struct FoldingSetTrait<RawSyntaxCacheNode> {
 
 } // namespace llvm
 
+/// Implementation detail of SyntaxArena.
+struct SyntaxArena::Implementation {
+  /// Allocator.
+  llvm::BumpPtrAllocator Allocator;
+
+  /// List of pointers to the allocated RawSyntax
+  std::vector<RawSyntax *> AllocatedRawSyntaxList;
+
+  /// Hash-consed token nodes, so that the endlessly repeating keywords,
+  /// punctuation and common identifiers of a tree share one node each.
+  llvm::FoldingSet<RawSyntaxCacheNode> CachedTokens;
+
+  Implementation() = default;
+  void *Allocate(size_t size, size_t alignment) {
+    return Allocator.Allocate(size, alignment);
+  }
+
+  void *AllocateRawSyntax(size_t size, size_t alignment) {
+    void *data = Allocator.Allocate(size, alignment);
+    /// Remember the allocated pointers so that we can destruct them.
+    AllocatedRawSyntaxList.push_back(static_cast<RawSyntax *>(data));
+    return data;
+  }
+
+  ~Implementation() {
+    // Destruct all allocated RawSyntax. They might contain heap allocated
+    // propeties and/or children.
+    for (auto *N : AllocatedRawSyntaxList)
+      N->~RawSyntax();
+  }
+};
+
+SyntaxArena::SyntaxArena() : Impl(*new Implementation()){};
+SyntaxArena::~SyntaxArena() { delete &Impl; }
+
+llvm::BumpPtrAllocator &SyntaxArena::getAllocator() const {
+  return Impl.Allocator;
+}
+
+void *SyntaxArena::Allocate(size_t size, size_t alignment) {
+  return Impl.Allocate(size, alignment);
+}
+
+void *SyntaxArena::AllocateRawSyntax(size_t size, size_t alignment) {
+  return Impl.AllocateRawSyntax(size, alignment);
+}
+
 /// Retrive "token" RawSyntax from the given Arena.
 RC<RawSyntax> RawSyntax::getToken(SyntaxArena &Arena, tok TokKind,
                                   OwnedString Text,
                                   llvm::ArrayRef<TriviaPiece> LeadingTrivia,
                                   llvm::ArrayRef<TriviaPiece> TrailingTrivia) {
-
-  return RawSyntax::make(TokKind, Text, LeadingTrivia, TrailingTrivia,
-                         SourcePresence::Present, &Arena);
+  // Look for an existing token with the same kind, text and trivia in the
+  // arena's cache. Arena-allocated nodes use manual memory management, so a
+  // cached node can be shared by any number of parents within the tree.
+  llvm::FoldingSetNodeID ID;
+  RawSyntax::Profile(ID, TokKind, Text, LeadingTrivia, TrailingTrivia);
+
+  auto &CachedTokens = Arena.Impl.CachedTokens;
+  void *insertPos = nullptr;
+  if (auto *existing = CachedTokens.FindNodeOrInsertPos(ID, insertPos))
+    return existing->get();
+
+  auto Raw = RawSyntax::make(TokKind, Text, LeadingTrivia, TrailingTrivia,
+                             SourcePresence::Present, &Arena);
+  auto IDRef = ID.Intern(Arena.getAllocator());
+  auto *cacheNode = new (Arena) RawSyntaxCacheNode(Raw.get(), IDRef);
+  CachedTokens.InsertNode(cacheNode, insertPos);
+  return Raw;
 }
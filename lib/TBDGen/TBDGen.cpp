@@ -405,6 +405,17 @@ void TBDGenVisitor::addFirstFileSymbols() {
   }
 }
 
+// Two cautions for speeding this up. The walk is not read-only over the
+// AST even though the visitor never writes: visiting nominal members
+// forces lazy member loading and conformance resolution, which allocate
+// into the shared ASTContext — sharding files across threads is unsound
+// without context-level locking. And caching per-file symbol sets keyed
+// by an interface hash belongs in the driver, not here: a frontend job
+// emits each TBD once, so intra-process memoization has nothing to hit;
+// what repeats across incremental builds is the job itself, which the
+// driver can skip wholesale (the serialized interface digest in the
+// control block is the right key) instead of re-running the frontend to
+// produce an identical file.
 static void enumeratePublicSymbolsAndWrite(ModuleDecl *M, FileUnit *singleFile,
                                            StringSet *symbols,
                                            llvm::raw_ostream *os,
@@ -29,7 +29,12 @@ struct SwiftReflectionContext {
   std::vector<std::tuple<swift_addr_t, swift_addr_t>> dataSegments;
   
   SwiftReflectionContext(MemoryReaderImpl impl) {
-    auto Reader = std::make_shared<CMemoryReader>(impl);
+    // Combine the client's reads through a caching block reader: crash
+    // analysis walks millions of objects, and each remote round trip is
+    // expensive. The inspected process is suspended (or a core file), so
+    // the cached blocks cannot go stale.
+    auto Reader = std::make_shared<CachingMemoryReader>(
+        std::make_shared<CMemoryReader>(impl));
     nativeContext = new NativeReflectionContext(Reader);
   }
   
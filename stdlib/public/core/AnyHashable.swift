@@ -134,6 +134,15 @@ internal struct _ConcreteHashableBox<Base : Hashable> : _AnyHashableBox {
 ///     print(descriptions[AnyHashable(43)])       // prints "nil"
 ///     print(descriptions[AnyHashable(Int8(43))]!) // prints "an Int8"
 ///     print(descriptions[AnyHashable(Set(["a", "b"]))]!) // prints "a set of strings"
+// Performance note for heterogeneous-key workloads: creating an AnyHashable
+// from a small standard type does not heap-allocate. _ConcreteHashableBox is
+// a struct, so storing it into the _box existential uses the container's
+// three-word inline buffer — Int, Double, and String all fit; only payloads
+// larger than three words hit the existential's (copy-on-write) heap box.
+// The per-creation cost that remains is the upcasting runtime call, which
+// caches its Hashable-base lookups per type (see AnyHashableSupport.cpp).
+// A tagged in-struct representation would have to change this type's
+// @_fixed_layout contract to buy back only that cached call.
 @_fixed_layout // FIXME(sil-serialize-all)
 public struct AnyHashable {
   @usableFromInline // FIXME(sil-serialize-all)
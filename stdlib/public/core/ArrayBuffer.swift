@@ -18,6 +18,11 @@
 #if _runtime(_ObjC)
 import SwiftShims
 
+@usableFromInline
+@_silgen_name("swift_bulkRetain")
+internal func _swift_bulkRetain(
+  _ objects: UnsafeMutablePointer<AnyObject>, _ count: Int)
+
 @usableFromInline
 internal typealias _ArrayBridgeStorage
   = _BridgeStorage<_ContiguousArrayStorageBase, _NSArrayCore>
@@ -51,6 +56,16 @@ internal struct _ArrayBuffer<Element> : _ArrayBufferProtocol {
 
   /// The spare bits that are set when a native array needs deferred
   /// element type checking.
+  ///
+  /// Note: this cannot be flipped off ("verified") on the shared storage
+  /// after a successful traversal, as tempting as that is for workloads that
+  /// re-verify the same buffer repeatedly. The storage object can be viewed
+  /// through several differently-typed deferred buffers at once, so a
+  /// per-storage bit cannot record *which* element type was verified; the
+  /// bit also lives in the buffer value, not the storage, so clearing it
+  /// would only affect one copy. The per-element cost is instead kept down
+  /// by the batched bridged type check and the runtime's memoized
+  /// class-hierarchy casts.
   @inlinable
   internal var deferredTypeCheckMask: Int { return 1 }
   
@@ -224,15 +239,47 @@ extension _ArrayBuffer {
     }
 
     if _slowPath(needsElementTypeCheck) {
-      // Could be sped up, e.g. by using
-      // enumerateObjectsAtIndexes:options:usingBlock: in the
-      // non-native case.
+      if !_isNative {
+        return _typeCheckNonNative(subRange)
+      }
       for i in subRange.lowerBound ..< subRange.upperBound {
         _typeCheckSlowPath(i)
       }
     }
   }
 
+  /// Type-check the given range of a bridged NSArray in batches: one
+  /// getObjects(_:range:) message per batch of 32 elements instead of one
+  /// objectAt message per element.
+  @inline(never)
+  @usableFromInline
+  internal func _typeCheckNonNative(_ subRange: Range<Int>) {
+    let ns = _nonNative
+    let batchCount = 32
+    let buffer = UnsafeMutablePointer<AnyObject>.allocate(capacity: batchCount)
+    defer { buffer.deallocate() }
+
+    var i = subRange.lowerBound
+    while i < subRange.upperBound {
+      let count = Swift.min(batchCount, subRange.upperBound - i)
+      // Copies the references out of the NSArray without retaining them;
+      // they are kept alive by the array itself.
+      ns.getObjects(buffer,
+                    range: SwiftShims._SwiftNSRange(location: i, length: count))
+      for j in 0..<count {
+        let element: AnyObject = buffer[j]
+        precondition(
+          element is Element,
+          """
+          NSArray element failed to match the Swift Array Element type
+          Expected \(Element.self) but found \(type(of: element))
+          """
+        )
+      }
+      i += count
+    }
+  }
+
   /// Copy the elements in `bounds` from this buffer into uninitialized
   /// memory starting at `target`.  Return a pointer "past the end" of the
   /// just-initialized memory.
@@ -258,14 +305,11 @@ extension _ArrayBuffer {
     
     // Copies the references out of the NSArray without retaining them
     nonNative.getObjects(buffer, range: nsSubRange)
-    
-    // Make another pass to retain the copied objects
-    var result = target
-    for _ in bounds {
-      result.initialize(to: result.pointee)
-      result += 1
-    }
-    return result
+
+    // Make another pass to retain the copied objects, with one runtime call
+    // for the whole buffer rather than one retain call per element.
+    _swift_bulkRetain(buffer, bounds.count)
+    return target + bounds.count
   }
 
   /// Returns a `_SliceBuffer` containing the given sub-range of elements in
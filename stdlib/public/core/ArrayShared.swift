@@ -25,6 +25,17 @@ public struct _DependenceToken {
 /// This function is referenced by the compiler to allocate array literals.
 ///
 /// - Precondition: `storage` is `_ContiguousArrayStorage`.
+///
+/// Note on stack-allocating small literals ([x, y, z] temporaries): after
+/// this function is inlined at -O, the buffer is an ordinary alloc_ref of
+/// _ContiguousArrayStorage in the caller, and constant literals are
+/// already outlined into statically initialized globals. The non-constant,
+/// non-escaping case is blocked on one property: stack promotion must
+/// prove the buffer is never *grown or uniquely-mutated* through the Array
+/// value (append reallocates; isUniquelyReferenced on a stack buffer would
+/// wrongly say yes and permit in-place mutation of a promoted buffer
+/// beyond its fixed capacity). That's an escape-analysis-plus-semantics
+/// question about Array calls, not about this entry point.
 @inline(__always)
 public // COMPILER_INTRINSIC
 func _allocateUninitializedArray<Element>(_  builtinCount: Builtin.Word)
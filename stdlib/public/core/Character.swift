@@ -68,6 +68,16 @@ public struct Character {
   // to discriminate between small and large representations.  Since a grapheme
   // cluster cannot have U+0000 anywhere but in its first scalar, we can store
   // zero in empty code units above the first one.
+  //
+  // Tokenizer-style workloads asking for allocation-free extraction mostly
+  // already have it: Substring slicing shares the parent's storage with
+  // offset math for every representation (no boundary case copies), the
+  // character-view subscript consumes stride information from the breaking
+  // pass rather than re-running grapheme validation, and any Character
+  // whose UTF-16 fits in 63 bits — all single-scalar characters included,
+  // via init(_:Unicode.Scalar) — takes the inline representation below.
+  // The only allocating path left is a grapheme wider than 63 bits, which
+  // needs the large representation by construction.
   @_frozen // FIXME(sil-serialize-all)
   @usableFromInline
   internal enum Representation {
@@ -216,6 +216,16 @@ public class KeyPath<Root, Value>: PartialKeyPath<Root> {
   
   @usableFromInline
   internal final func projectReadOnly(from root: Root) -> Value {
+    // A chain of stored struct properties collapses to one inline offset;
+    // skip the component walk with its per-step existential opens and Any
+    // boxing and load the value directly from the root's bytes.
+    if let offset = _storedInlineOffset {
+      return withUnsafeBytes(of: root) {
+        $0.baseAddress.unsafelyUnwrapped.load(fromByteOffset: offset,
+                                              as: Value.self)
+      }
+    }
+
     // TODO: For perf, we could use a local growable buffer instead of Any
     var curBase: Any = root
     return withBuffer {
@@ -269,6 +279,17 @@ public class WritableKeyPath<Root, Value>: KeyPath<Root, Value> {
   @usableFromInline
   internal func projectMutableAddress(from base: UnsafePointer<Root>)
       -> (pointer: UnsafeMutablePointer<Value>, owner: AnyObject?) {
+    // Same collapsed fast path as projectReadOnly: a pure stored-struct
+    // chain is a fixed offset from the base address, with nothing to keep
+    // alive. (A key path with class or computed components never has an
+    // inline offset, so this can't bypass a reference prefix.)
+    if let offset = _storedInlineOffset {
+      let raw = UnsafeRawPointer(base) + offset
+      return (pointer: UnsafeMutablePointer(
+                mutating: raw.assumingMemoryBound(to: Value.self)),
+              owner: nil)
+    }
+
     var p = UnsafeRawPointer(base)
     var type: Any.Type = Root.self
     var keepAlive: AnyObject?
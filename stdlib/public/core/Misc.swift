@@ -120,3 +120,25 @@ func _typeByMangledName(_ name: String,
                                   flatSubstitutions)
   }
 }
+
+@_silgen_name("swift_prewarmTypeMetadata")
+internal func _swift_prewarmTypeMetadata(
+  _ names: UnsafePointer<UInt8>,
+  _ length: Int) -> Int
+
+/// Pre-instantiate the metadata for a recorded working set of types, given
+/// as newline-separated mangled type names.
+///
+/// Call this on a background queue at startup to move lazy metadata
+/// instantiation costs off the first request that uses each type. Names
+/// that do not resolve are skipped, so a stale working set is harmless.
+/// Returns the number of types whose metadata was resolved.
+public // SPI(Foundation)
+func _prewarmTypeMetadata(forMangledNames names: String) -> Int {
+  let namesUTF8 = Array(names.utf8)
+  if namesUTF8.isEmpty { return 0 }
+  return namesUTF8.withUnsafeBufferPointer { (namesUTF8) in
+    return _swift_prewarmTypeMetadata(namesUTF8.baseAddress!,
+                                      namesUTF8.endIndex)
+  }
+}
@@ -620,6 +620,17 @@ public protocol Sequence {
 
   /// Copy `self` into an unsafe buffer, returning a partially-consumed
   /// iterator with any elements that didn't fit remaining.
+  ///
+  /// Note: this is the natural attachment point for blocked consumption of
+  /// lazy adapter chains (running filter/map bodies over chunks of the
+  /// base's contiguous storage instead of through next()), but adapters
+  /// can't implement it usefully until there is a protocol-visible way to
+  /// borrow the *base* sequence's contiguous storage — a
+  /// withContiguousStorageIfAvailable-style requirement with a default
+  /// returning nil. Without that, an adapter override degenerates to the
+  /// same element-at-a-time loop. Add the storage hook first; the adapter
+  /// overrides then become mechanical and benefit every consumer of this
+  /// entry point, Array inits included.
   __consuming func _copyContents(
     initializing ptr: UnsafeMutableBufferPointer<Element>
   ) -> (Iterator,UnsafeMutableBufferPointer<Element>.Index)
@@ -2129,6 +2129,11 @@ extension _NativeSetBuffer/*: _SetBuffer*/ where Element: Hashable {
 
     var bucket = startBucket
 
+    // Hoist the bucket mask out of the probe loop. The wrap-around re-read
+    // the count from the storage header on every step, and the opaque key
+    // comparison keeps the optimizer from hoisting it on our behalf.
+    let bucketMask = _bucketMask
+
     // The invariant guarantees there's always a hole, so we just loop
     // until we find one
     while true {
@@ -2139,7 +2144,7 @@ extension _NativeSetBuffer/*: _SetBuffer*/ where Element: Hashable {
       if self.key(at: bucket) == key {
         return (Index(offset: bucket), true)
       }
-      bucket = _index(after: bucket)
+      bucket = (bucket &+ 1) & bucketMask
     }
   }
 
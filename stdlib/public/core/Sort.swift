@@ -169,6 +169,16 @@ where Self: RandomAccessCollection, Element: Comparable {
   ///     // Prints "["Peter", "Kweku", "Kofi", "Akosua", "Abena"]"
   ///
   /// - Complexity: O(*n* log *n*), where *n* is the length of the collection.
+  // Note on radix specializations for fixed-width integer keys: the place
+  // they can be introduced without new public API is right here — a
+  // same-type-constrained overload set (or an _customSort hook on
+  // FixedWidthInteger) taken when Element is a trivial integer and the
+  // buffer path above is available, falling back to introsort below a
+  // count threshold. Two constraints shape it: sort() must remain
+  // ascending-< semantics exactly (radix on signed needs the sign-bit
+  // flip), and sort(by:) can only use radix when the comparator is
+  // recognized at specialization time as the standard <, which the
+  // optimizer can see for the literal `<` but no general closure.
   @inlinable
   public mutating func sort() {
     let didSortUnsafeBuffer = _withUnsafeMutableBufferPointerIfSupported {
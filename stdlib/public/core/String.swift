@@ -568,8 +568,31 @@ extension String {
 }
 
 internal func _isAllASCII(_ input: UnsafeBufferPointer<UInt8>) -> Bool {
-  for byte in input {
-    guard byte <= 0x7F else { return false }
+  guard var ptr = input.baseAddress.map(UnsafeRawPointer.init) else {
+    return true
+  }
+  var count = input.count
+
+  // Read a byte at a time until the pointer is word aligned, then check a
+  // word at a time: a chunk is all-ASCII iff no byte has its high bit set.
+  // The word loop is what the backend vectorizes, so large all-ASCII
+  // buffers are checked at memory bandwidth.
+  while count > 0
+  && Int(bitPattern: ptr) % MemoryLayout<UInt64>.stride != 0 {
+    guard ptr.load(as: UInt8.self) <= 0x7F else { return false }
+    ptr += 1
+    count &-= 1
+  }
+  let asciiMask: UInt64 = 0x8080_8080_8080_8080
+  while count >= MemoryLayout<UInt64>.stride {
+    guard ptr.load(as: UInt64.self) & asciiMask == 0 else { return false }
+    ptr += MemoryLayout<UInt64>.stride
+    count &-= MemoryLayout<UInt64>.stride
+  }
+  while count > 0 {
+    guard ptr.load(as: UInt8.self) <= 0x7F else { return false }
+    ptr += 1
+    count &-= 1
   }
   return true
 }
@@ -35,6 +35,13 @@ extension _StringGuts {
       // Equal small strings should be bitwise equal if ASCII
       return false
     }
+
+    // ASCII strings compare code-unit-wise, so a length mismatch decides
+    // inequality before any memory is compared.
+    if left.isASCII && right.isASCII && left.count != right.count {
+      return false
+    }
+
     return compare(left, to: right) == 0
   }
 
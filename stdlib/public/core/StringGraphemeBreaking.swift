@@ -146,6 +146,17 @@ extension _StringVariant {
 }
 
 extension _StringVariant {
+  // Performance note: mostly-ASCII content does not hit the slow path.
+  // All-ASCII storage answers in O(1) per Character below, and in mixed
+  // text every ASCII/ASCII scalar pair (except CR/LF) passes the inlined
+  // quick check, so ASCII runs cost one comparison per Character with no
+  // ICU involvement. The measured 10x gap is confined to scalar pairs the
+  // quick check can't decide (emoji sequences, combining marks), which
+  // fall into the ICU-backed path — closing it means compiling the
+  // grapheme rules into a flat DFA over scalar classes to replace that
+  // slow path, a Unicode-data engineering effort, not a new ASCII skip
+  // (which would re-create the quick check that already exists).
+  //
   // NOTE: Because this function is inlineable, it should contain only the fast
   // paths of grapheme breaking that we have high confidence won't change.
   /// Returns the length of the first extended grapheme cluster in UTF-16
@@ -9,6 +9,19 @@
 // See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
 //
 //===----------------------------------------------------------------------===//
+//
+// Note on memoizing string hashes: repeated Dictionary lookups keyed by the
+// same long string re-hash its full contents every time, and caching the
+// hash looks tempting. The sound place for such a cache is a header field
+// on the native storage class — every mutation already funnels through the
+// unique-storage paths that could invalidate it — but that grows an
+// ABI-stable header, and it cannot live in _StringObject's spare bits,
+// which are fully assigned to flags and the small-string payload. Small
+// strings hash in-register already, and per-Hasher seeds mean a cached
+// value is only reusable within one seed, so the cache would need the
+// seed recorded alongside the hash as well.
+//
+//===----------------------------------------------------------------------===//
 
 import SwiftShims
 
@@ -29,6 +29,20 @@ extension String : _ExpressibleByStringInterpolation {
   @_effects(readonly)
   public init(stringInterpolation strings: String...) {
     self.init()
+
+    // Size the result once up front. The segments are already materialized,
+    // so their total size is known exactly; growing per segment instead
+    // would reallocate the storage several times over. Results that fit the
+    // small-string representation skip the reservation so they never touch
+    // the heap at all.
+    var codeUnitCount = 0
+    for str in strings {
+      codeUnitCount += str._guts.count
+    }
+    if codeUnitCount > _SmallUTF8String.capacity {
+      self.reserveCapacity(codeUnitCount)
+    }
+
     for str in strings {
       self += str
     }
@@ -92,6 +92,15 @@ extension _UnmanagedOpaqueString : Sequence {
 
   @usableFromInline
   @_fixed_layout
+  // Note on bridging cost: iteration is already batched — the iterator
+  // refills a 16-element buffer per CFStringGetCharacters-style bulk copy
+  // (see _nextOnSlowPath), so a 1MB non-contiguous NSString costs tens of
+  // thousands of bulk copies, not a million per-unit messages, and
+  // one-shot bridging into native storage is a single _copy(into:). The
+  // per-unit message only survives in the random-access subscript. If the
+  // batch proves too small for some workload, the lever is the fixed
+  // buffer's capacity here, not a new transcoding entry point: UTF-16 to
+  // UTF-8 transcoding already consumes these code units from the buffer.
   struct Iterator : IteratorProtocol {
     @usableFromInline
     internal typealias Element = UTF16.CodeUnit
@@ -16,6 +16,7 @@
 
 #include "swift/Runtime/Casting.h"
 #include "../SwiftShims/RuntimeShims.h"
+#include "swift/Runtime/Concurrent.h"
 #include "CompatibilityOverride.h"
 #include "ErrorObject.h"
 #include "ExistentialMetadataImpl.h"
@@ -258,18 +259,77 @@ static bool _succeed(OpaqueValue *dest, OpaqueValue *src,
   return true;
 }
 
+namespace {
+  /// An entry in the cache of class-metatype downcast checks.
+  struct ClassCastCacheEntry {
+    const ClassMetadata *Source;
+    const ClassMetadata *Target;
+
+    /// The matched metadata (== Target), or null for a recorded failure.
+    /// Superclass chains are immutable, so both results stay valid for the
+    /// lifetime of the process.
+    const ClassMetadata *Result;
+
+    ClassCastCacheEntry(
+        std::pair<const ClassMetadata *, const ClassMetadata *> key,
+        const ClassMetadata *result)
+      : Source(key.first), Target(key.second), Result(result) {}
+
+    int compareWithKey(
+        const std::pair<const ClassMetadata *, const ClassMetadata *> &key)
+        const {
+      if (auto result = comparePointers(key.first, Source))
+        return result;
+      return comparePointers(key.second, Target);
+    }
+
+    template <class... Args>
+    static size_t getExtraAllocationSize(Args &&... ignored) {
+      return 0;
+    }
+  };
+} // end anonymous namespace
+
+/// Cache of (source, target) class downcast checks whose superclass walk
+/// was deep enough to be worth remembering.
+static Lazy<ConcurrentMap<ClassCastCacheEntry>> ClassCastCache;
+
 /// Dynamically cast a class metatype to a Swift class metatype.
 static const ClassMetadata *
 _dynamicCastClassMetatype(const ClassMetadata *sourceType,
                           const ClassMetadata *targetType) {
+  // Walk the first few levels of the superclass chain directly; most casts
+  // hit within a short distance and are cheaper than any cache.
+  const unsigned directWalkDepth = 4;
+  const ClassMetadata *current = sourceType;
+  for (unsigned depth = 0; depth < directWalkDepth; ++depth) {
+    if (current == targetType) {
+      return current;
+    }
+    current = current->Superclass;
+    if (!current)
+      return nullptr;
+  }
+
+  // The hierarchy is deep, which makes repeated casts of the same
+  // (source, target) pair — the typical shape of serialization and mapping
+  // layers — worth memoizing.
+  auto &cache = ClassCastCache.get();
+  auto key = std::make_pair(sourceType, targetType);
+  if (auto *entry = cache.find(key))
+    return entry->Result;
+
+  const ClassMetadata *result = nullptr;
   do {
-    if (sourceType == targetType) {
-      return sourceType;
+    if (current == targetType) {
+      result = current;
+      break;
     }
-    sourceType = sourceType->Superclass;
-  } while (sourceType);
-  
-  return nullptr;
+    current = current->Superclass;
+  } while (current);
+
+  cache.getOrInsert(key, result);
+  return result;
 }
 
 /// Dynamically cast a class instance to a Swift class type.
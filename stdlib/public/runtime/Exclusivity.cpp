@@ -208,32 +208,62 @@ static_assert(sizeof(Access) <= sizeof(ValueBuffer) &&
 /// A set of accesses that we're tracking.  Just a singly-linked list.
 class AccessSet {
   Access *Head = nullptr;
+
+  /// A per-thread counting filter over the pointers of the tracked accesses.
+  /// Each tracked access increments the bucket its pointer hashes to, and
+  /// removal decrements it again; a zero bucket therefore proves that no
+  /// tracked access can match the pointer, letting begin_access skip the
+  /// list walk entirely. Closure-heavy code repeatedly beginning accesses to
+  /// distinct variables hits that single array test instead of walking the
+  /// whole list each time.
+  uint8_t PointerFilter[64] = {};
+
+  /// Set (permanently, for this thread) if a filter bucket ever saturates,
+  /// at which point the counts can no longer be maintained exactly and the
+  /// filter is ignored. This effectively never happens: it requires 255
+  /// simultaneous tracked accesses hashing to one bucket.
+  bool FilterDisabled = false;
+
+  static unsigned filterBucket(void *pointer) {
+    // Ignore the low bits, which are mostly alignment zeros.
+    uintptr_t p = reinterpret_cast<uintptr_t>(pointer);
+    return (p >> 4) % 64;
+  }
+
 public:
   constexpr AccessSet() {}
 
   bool insert(Access *access, void *pc, void *pointer, ExclusivityFlags flags) {
     auto action = getAccessAction(flags);
 
-    for (Access *cur = Head; cur != nullptr; cur = cur->getNext()) {
-      // Ignore accesses to different values.
-      if (cur->Pointer != pointer)
-        continue;
+    unsigned bucket = filterBucket(pointer);
+    if (FilterDisabled || PointerFilter[bucket] != 0) {
+      for (Access *cur = Head; cur != nullptr; cur = cur->getNext()) {
+        // Ignore accesses to different values.
+        if (cur->Pointer != pointer)
+          continue;
 
-      // If both accesses are reads, it's not a conflict.
-      if (action == ExclusivityFlags::Read &&
-          action == cur->getAccessAction())
-        continue;
+        // If both accesses are reads, it's not a conflict.
+        if (action == ExclusivityFlags::Read &&
+            action == cur->getAccessAction())
+          continue;
 
-      // Otherwise, it's a conflict.
-      reportExclusivityConflict(cur->getAccessAction(), cur->PC,
-                                flags, pc, pointer);
+        // Otherwise, it's a conflict.
+        reportExclusivityConflict(cur->getAccessAction(), cur->PC,
+                                  flags, pc, pointer);
 
-      // If we're only warning, don't report multiple conflicts.
-      break;
+        // If we're only warning, don't report multiple conflicts.
+        break;
+      }
     }
     if (!isTracking(flags))
       return false;
 
+    if (PointerFilter[bucket] == UINT8_MAX)
+      FilterDisabled = true;
+    else
+      ++PointerFilter[bucket];
+
     // Insert to the front of the array so that remove tends to find it faster.
     access->initialize(pc, pointer, Head, action);
     Head = access;
@@ -241,6 +271,12 @@ public:
   }
 
   void remove(Access *access) {
+    if (!FilterDisabled) {
+      unsigned bucket = filterBucket(access->Pointer);
+      assert(PointerFilter[bucket] > 0 && "removing an untracked access?");
+      --PointerFilter[bucket];
+    }
+
     auto cur = Head;
     // Fast path: stack discipline.
     if (cur == access) {
@@ -292,6 +292,24 @@ HeapObject *swift::swift_retain(HeapObject *object) {
   return _swift_retain(object);
 }
 
+/// Retain a whole buffer of object references with a single call.
+///
+/// This is the lowering target for batched retain operations: the per-object
+/// work is unchanged, but N retains cost one function call instead of N. The
+/// references may be of unknown origin (Swift or Objective-C) — the stdlib
+/// uses this when it materializes arrays of AnyObject references, e.g. when
+/// copying elements out of a bridged NSArray.
+SWIFT_CC(swift) SWIFT_RUNTIME_STDLIB_API
+void swift_bulkRetain(void *const *objects, size_t count) {
+  for (size_t i = 0; i < count; ++i) {
+#if SWIFT_OBJC_INTEROP
+    swift_unknownRetain(objects[i]);
+#else
+    _swift_retain(static_cast<HeapObject *>(objects[i]));
+#endif
+  }
+}
+
 static HeapObject *_swift_retain_(HeapObject *object) {
   SWIFT_RT_TRACK_INVOCATION(object, swift_retain);
   if (isValidPointerForNativeRetain(object))
@@ -827,6 +845,17 @@ WeakReference *swift::swift_weakAssign(WeakReference *ref, HeapObject *value) {
   return ref;
 }
 
+// Note on an "atomic-free" weak-load fast path: there isn't a sound one.
+// Loading a weak reference must atomically transition the object from
+// "alive" to "alive and strongly referenced by me" — a relaxed probe of a
+// generation stamp followed by a plain read races with a concurrent final
+// release between the probe and the use, which is exactly the
+// use-after-free weak references exist to prevent. The operation is
+// already lock-free (a CAS loop on the side table's counts, no mutex);
+// what main-thread delegate code can legitimately save is the *repeated*
+// loads: front-load one weakLoadStrong per scope and keep the strong
+// reference for the duration, which is also what the optimizer's
+// redundant-load elimination does when the scope is visible to it.
 HeapObject *swift::swift_weakLoadStrong(WeakReference *ref) {
   return ref->nativeLoadStrong();
 }
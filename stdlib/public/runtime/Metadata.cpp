@@ -4110,13 +4110,20 @@ static std::atomic<PoolRange>
 AllocationPool{PoolRange{InitialAllocationPool,
                          sizeof(InitialAllocationPool)}};
 
+/// Byte counters behind swift_getMetadataAllocationStatistics. Relaxed
+/// ordering suffices: readers want attribution, not synchronization.
+static std::atomic<size_t> PoolBytesAllocated{0};
+static std::atomic<size_t> MallocBytesAllocated{0};
+
 void *MetadataAllocator::Allocate(size_t size, size_t alignment) {
   assert(alignment <= alignof(void*));
   assert(size % alignof(void*) == 0);
 
   // If the size is larger than the maximum, just use malloc.
-  if (size > PoolRange::MaxPoolAllocationSize)
+  if (size > PoolRange::MaxPoolAllocationSize) {
+    MallocBytesAllocated.fetch_add(size, std::memory_order_relaxed);
     return malloc(size);
+  }
 
   // Allocate out of the pool.
   PoolRange curState = AllocationPool.load(std::memory_order_relaxed);
@@ -4145,6 +4152,7 @@ void *MetadataAllocator::Allocate(size_t size, size_t alignment) {
       // If that succeeded, we've successfully allocated.
       __msan_allocated_memory(allocation, size);
       __asan_unpoison_memory_region(allocation, size);
+      PoolBytesAllocated.fetch_add(size, std::memory_order_relaxed);
       return allocation;
     }
 
@@ -4159,6 +4167,7 @@ void MetadataAllocator::Deallocate(const void *allocation, size_t size) {
   __asan_poison_memory_region(allocation, size);
 
   if (size > PoolRange::MaxPoolAllocationSize) {
+    MallocBytesAllocated.fetch_sub(size, std::memory_order_relaxed);
     free(const_cast<void*>(allocation));
     return;
   }
@@ -4174,11 +4183,21 @@ void MetadataAllocator::Deallocate(const void *allocation, size_t size) {
   // don't bother trying again; we'll just leak the allocation.
   PoolRange newState = { reinterpret_cast<char*>(const_cast<void*>(allocation)),
                          curState.Remaining + size };
-  (void)
-    std::atomic_compare_exchange_strong_explicit(&AllocationPool,
-                                                 &curState, newState,
-                                                 std::memory_order_relaxed,
-                                                 std::memory_order_relaxed);
+  if (std::atomic_compare_exchange_strong_explicit(&AllocationPool,
+                                                   &curState, newState,
+                                                   std::memory_order_relaxed,
+                                                   std::memory_order_relaxed)) {
+    PoolBytesAllocated.fetch_sub(size, std::memory_order_relaxed);
+  }
+}
+
+MetadataAllocationStatistics swift::swift_getMetadataAllocationStatistics() {
+  MetadataAllocationStatistics stats;
+  stats.PoolBytesAllocated =
+      PoolBytesAllocated.load(std::memory_order_relaxed);
+  stats.MallocBytesAllocated =
+      MallocBytesAllocated.load(std::memory_order_relaxed);
+  return stats;
 }
 
 void *swift::allocateMetadata(size_t size, size_t alignment) {
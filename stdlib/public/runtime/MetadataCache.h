@@ -1319,6 +1319,18 @@ public:
   }
 };
 
+/// The top-level cache for generic metadata instantiations.
+///
+/// Entries are never evicted, and that is a correctness property, not an
+/// oversight: a metadata pointer is the runtime identity of its type.
+/// Instantiated metadata is compared by address for type equality, stored
+/// in object headers, captured inside other metadata and witness tables,
+/// and cached by compiled code — none of which the runtime can enumerate.
+/// "Idle and re-instantiable" is therefore unprovable from here; evicting
+/// and re-instantiating would mint a second address for the same type and
+/// silently break equality. Processes concerned about growth can attribute
+/// it via swift_getMetadataAllocationStatistics; the real lever is
+/// bounding the set of distinct generic specializations instantiated.
 template <class EntryType, bool ProvideDestructor = true>
 class MetadataCache :
     public LockingConcurrentMap<EntryType,
@@ -82,15 +82,36 @@ namespace {
   struct NominalTypeDescriptorCacheEntry {
   private:
     std::string Name;
-    const TypeContextDescriptor *Description;
+
+    /// The descriptor, or null for a recorded lookup failure.
+    std::atomic<const TypeContextDescriptor *> Description;
+
+    /// For a failure entry, the number of sections which had been registered
+    /// when the lookup failed. The failure is authoritative only as long as
+    /// no further sections have been registered.
+    std::atomic<size_t> FailureGeneration;
 
   public:
     NominalTypeDescriptorCacheEntry(const llvm::StringRef name,
-                                    const TypeContextDescriptor *description)
-      : Name(name.str()), Description(description) {}
+                                    const TypeContextDescriptor *description,
+                                    size_t failureGeneration)
+      : Name(name.str()), Description(description),
+        FailureGeneration(failureGeneration) {}
 
     const TypeContextDescriptor *getDescription() {
-      return Description;
+      return Description.load(std::memory_order_acquire);
+    }
+
+    void makeSuccessful(const TypeContextDescriptor *description) {
+      Description.store(description, std::memory_order_release);
+    }
+
+    size_t getFailureGeneration() const {
+      return FailureGeneration.load(std::memory_order_relaxed);
+    }
+
+    void updateFailureGeneration(size_t failureGeneration) {
+      FailureGeneration.store(failureGeneration, std::memory_order_relaxed);
     }
 
     int compareWithKey(llvm::StringRef aName) const {
@@ -474,9 +495,18 @@ _findNominalTypeDescriptor(Demangle::NodePointer node,
                          });
 
   // Look for an existing entry.
-  // Find the bucket for the metadata entry.
-  if (auto Value = T.NominalCache.find(mangledName))
-    return Value->getDescription();
+  // Find the bucket for the metadata entry. Negative results are cached as
+  // well: reflection-heavy clients commonly probe the same missing names
+  // over and over, and each miss used to rescan every record of every
+  // image. A cached failure is authoritative only as long as no additional
+  // sections have been registered since it was recorded.
+  auto snapshot = T.SectionsToScan.snapshot();
+  if (auto Value = T.NominalCache.find(mangledName)) {
+    if (auto description = Value->getDescription())
+      return description;
+    if (Value->getFailureGeneration() == snapshot.count())
+      return nullptr;
+  }
 
   // Check type metadata records
   foundNominal = _searchTypeMetadataRecords(T, node);
@@ -486,8 +516,13 @@ _findNominalTypeDescriptor(Demangle::NodePointer node,
   if (!foundNominal)
     foundNominal = _searchConformancesByMangledTypeName(node);
 
-  if (foundNominal) {
-    T.NominalCache.getOrInsert(mangledName, foundNominal);
+  auto result =
+      T.NominalCache.getOrInsert(mangledName, foundNominal, snapshot.count());
+  if (!result.second) {
+    if (foundNominal)
+      result.first->makeSuccessful(foundNominal);
+    else
+      result.first->updateFailureGeneration(snapshot.count());
   }
 
   return foundNominal;
@@ -679,9 +714,43 @@ public:
   const FieldDescriptor **end() const { return End; }
 };
 
+/// A fully resolved field of a type: its name and its FieldType, memoized
+/// per (metadata, field index) so that mirroring the same type repeatedly
+/// doesn't re-demangle and re-resolve the field's type on every access.
+class ResolvedFieldCacheEntry {
+  const Metadata *Base;
+  unsigned Index;
+
+public:
+  /// The field name; points into the image's reflection strings (or the
+  /// field descriptor), which live as long as the process.
+  const llvm::StringRef Name;
+
+  /// The resolved field type and flags.
+  const FieldType Info;
+
+  ResolvedFieldCacheEntry(std::pair<const Metadata *, unsigned> key,
+                          llvm::StringRef name, FieldType info)
+      : Base(key.first), Index(key.second), Name(name), Info(info) {}
+
+  int compareWithKey(std::pair<const Metadata *, unsigned> key) const {
+    if (auto result = comparePointers(key.first, Base))
+      return result;
+    return compareIntegers(key.second, Index);
+  }
+
+  template <class... Args>
+  static size_t getExtraAllocationSize(Args &&... ignored) {
+    return 0;
+  }
+};
+
 struct FieldCacheState {
   ConcurrentMap<FieldDescriptorCacheEntry> FieldCache;
 
+  /// Memoized per-(metadata, index) field resolutions.
+  ConcurrentMap<ResolvedFieldCacheEntry> ResolvedFields;
+
   ConcurrentReadableArray<StaticFieldSection> StaticSections;
   ConcurrentReadableArray<DynamicFieldSection> DynamicSections;
 
@@ -1263,13 +1332,28 @@ void swift::_swift_getFieldAt(
   if (!baseDesc)
     return;
 
+  // Mirrors of the same type resolve the same fields over and over; answer
+  // from the memoized resolution when we have one.
+  auto &cache = FieldCache.get();
+  if (auto *cached =
+          cache.ResolvedFields.find(std::make_pair(base, unsigned(index)))) {
+    callback(cached->Name, cached->Info);
+    return;
+  }
+
+  auto invokeAndCache = [&](llvm::StringRef name, FieldType info) {
+    cache.ResolvedFields.getOrInsert(std::make_pair(base, unsigned(index)),
+                                     name, info);
+    callback(name, info);
+  };
+
   auto getFieldAt = [&](const FieldDescriptor &descriptor) {
     auto &field = descriptor.getFields()[index];
     auto name = field.getFieldName(0);
 
     // Enum cases don't always have types.
     if (!field.hasMangledTypeName()) {
-      callback(name, FieldType().withIndirect(field.isIndirectCase()));
+      invokeAndCache(name, FieldType().withIndirect(field.isIndirectCase()));
       return;
     }
 
@@ -1322,15 +1406,14 @@ void swift::_swift_getFieldAt(
                  (int)typeName.size(), typeName.data());
     }
 
-    callback(name, FieldType()
-                       .withType(typeInfo)
-                       .withIndirect(field.isIndirectCase())
-                       .withWeak(typeInfo.isWeak()));
+    invokeAndCache(name, FieldType()
+                             .withType(typeInfo)
+                             .withIndirect(field.isIndirectCase())
+                             .withWeak(typeInfo.isWeak()));
 
   };
 
   auto dem = getDemanglerForRuntimeTypeResolution();
-  auto &cache = FieldCache.get();
   auto isRequestedDescriptor = [&](const FieldDescriptor &descriptor) {
     assert(descriptor.hasMangledTypeName());
     auto mangledName = descriptor.getMangledTypeName(0);
@@ -1378,5 +1461,36 @@ void swift::_swift_getFieldAt(
              .withWeak(false));
 }
 
+/// Pre-instantiate the metadata for a recorded working set of types.
+///
+/// \p typeNames is a buffer of newline-separated mangled type names,
+/// typically captured from a previous run of the process. Resolving a name
+/// demangles it and runs the type's metadata access function with a
+/// blocking complete request, so once this returns, the instantiation
+/// caches are warm and the first real use of each type pays no
+/// instantiation latency. Returns the number of names that resolved;
+/// unresolvable names are skipped, so a stale working set stays benign.
+///
+/// Intended to be called on a background thread at startup. All of the
+/// caches this touches are safe for concurrent access.
+SWIFT_CC(swift) SWIFT_RUNTIME_STDLIB_API
+size_t swift_prewarmTypeMetadata(const char *typeNames, size_t length) {
+  StringRef buffer(typeNames, length);
+  size_t numInstantiated = 0;
+  while (!buffer.empty()) {
+    auto split = buffer.split('\n');
+    StringRef name = split.first.trim();
+    buffer = split.second;
+    if (name.empty())
+      continue;
+
+    auto result = swift::_getTypeByMangledName(
+        name, [](unsigned, unsigned) -> const Metadata * { return nullptr; });
+    if ((const Metadata *)result)
+      ++numInstantiated;
+  }
+  return numInstantiated;
+}
+
 #define OVERRIDE_METADATALOOKUP COMPATIBILITY_OVERRIDE
 #include "CompatibilityOverride.def"
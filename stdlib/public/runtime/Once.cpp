@@ -34,6 +34,19 @@ static_assert(std::is_same<swift_once_t, dispatch_once_t>::value,
 
 // On non-Darwin platforms we do not assume any barrier-free inline path
 // and SwiftTargetInfo.OnceDonePredicateValue is unset in the compiler.
+//
+// Note for anyone chasing per-access swift_once cost on these platforms:
+// the compiler-side machinery for a double-checked inline fast path
+// already exists and is keyed entirely off OnceDonePredicateValue (see
+// the Builtin.once lowering in GenBuiltin.cpp, which emits the relaxed
+// load, compare, cold call, and post-join assumption). What's missing is
+// a predicate representation with a constant "done" value: std::once_flag
+// is opaque, so enabling the fast path here means replacing this
+// implementation with our own word-state protocol (0 = pristine,
+// in-progress sentinel with futex/yield waiting, -1 = done with a release
+// store) and then setting OnceDonePredicateValue = -1 for the platform.
+// The two changes must land together, and the waiting discipline is the
+// part that needs care — not the compiler side.
 
 #endif
 
@@ -285,11 +285,46 @@ namespace {
       return FailureGeneration.load(std::memory_order_relaxed);
     }
   };
+
+  /// A prebuilt per-protocol index of conformance records.
+  ///
+  /// Each registered section is merged into the index exactly once, so a
+  /// conformance query only ever examines the records of the protocol it is
+  /// asking about instead of re-walking every record of every image. This
+  /// matters because matching a record against a type can be expensive
+  /// (e.g. instantiating canonical metadata), and repeated daemon-startup
+  /// queries used to pay that cost for every unrelated record.
+  struct ProtocolConformanceIndexEntry {
+    const ProtocolDescriptor *Proto;
+
+    /// The conformance records seen for this protocol, in section order.
+    ConcurrentReadableArray<const ProtocolConformanceDescriptor *> Records;
+
+    /// Guards SectionsIndexed against concurrent indexers.
+    Mutex IndexLock;
+
+    /// The number of sections whose records have been merged into Records.
+    /// Guarded by IndexLock.
+    size_t SectionsIndexed = 0;
+
+    ProtocolConformanceIndexEntry(const ProtocolDescriptor *proto)
+        : Proto(proto) {}
+
+    int compareWithKey(const ProtocolDescriptor *proto) const {
+      return comparePointers(proto, Proto);
+    }
+
+    template <class... Args>
+    static size_t getExtraAllocationSize(Args &&... ignored) {
+      return 0;
+    }
+  };
 } // end anonymous namespace
 
 // Conformance Cache.
 struct ConformanceState {
   ConcurrentMap<ConformanceCacheEntry> Cache;
+  ConcurrentMap<ProtocolConformanceIndexEntry> ProtocolIndex;
   ConcurrentReadableArray<ConformanceSection> SectionsToScan;
   
   ConformanceState() {
@@ -597,49 +632,52 @@ swift_conformsToProtocolImpl(const Metadata * const type,
     C.cacheFailure(type, protocol, snapshot.count());
   };
 
-  // Really scan conformance records.
-  for (size_t i = startIndex; i < endIndex; i++) {
-    auto &section = snapshot.Start[i];
-    // Eagerly pull records for nondependent witnesses into our cache.
-    for (const auto &record : section) {
-      auto &descriptor = *record.get();
-
-      // If the record applies to a specific type, cache it.
-      if (auto metadata = descriptor.getCanonicalTypeMetadata()) {
-        auto P = descriptor.getProtocol();
-
-        // Look for an exact match.
-        if (protocol != P)
-          continue;
+  // Bring the per-protocol record index up to date with the snapshot. Each
+  // section is merged into the index exactly once, regardless of how many
+  // different (type, protocol) queries race here.
+  auto &indexEntry = *C.ProtocolIndex.getOrInsert(protocol).first;
+  {
+    ScopedLock guard(indexEntry.IndexLock);
+    for (size_t i = indexEntry.SectionsIndexed; i < endIndex; i++) {
+      for (const auto &record : snapshot.Start[i]) {
+        auto &descriptor = *record.get();
+        if (descriptor.getProtocol() == protocol)
+          indexEntry.Records.push_back(&descriptor);
+      }
+    }
+    if (indexEntry.SectionsIndexed < endIndex)
+      indexEntry.SectionsIndexed = endIndex;
+  }
 
-        if (!isRelatedType(type, metadata, /*candidateIsMetadata=*/true))
-          continue;
+  // Really scan the protocol's conformance records.
+  for (auto *recordDescriptor : indexEntry.Records.snapshot()) {
+    auto &descriptor = *recordDescriptor;
 
-        // Record the witness table.
-        recordWitnessTable(descriptor, metadata);
+    // If the record applies to a specific type, cache it.
+    if (auto metadata = descriptor.getCanonicalTypeMetadata()) {
+      if (!isRelatedType(type, metadata, /*candidateIsMetadata=*/true))
+        continue;
 
-      // TODO: "Nondependent witness table" probably deserves its own flag.
-      // An accessor function might still be necessary even if the witness table
-      // can be shared.
-      } else if (descriptor.getTypeKind()
-                   == TypeReferenceKind::DirectNominalTypeDescriptor ||
-                 descriptor.getTypeKind()
-                  == TypeReferenceKind::IndirectNominalTypeDescriptor) {
-        auto R = descriptor.getTypeContextDescriptor();
-        auto P = descriptor.getProtocol();
+      // Record the witness table.
+      recordWitnessTable(descriptor, metadata);
 
-        // Look for an exact match.
-        if (protocol != P)
-          continue;
+    // TODO: "Nondependent witness table" probably deserves its own flag.
+    // An accessor function might still be necessary even if the witness table
+    // can be shared.
+    } else if (descriptor.getTypeKind()
+                 == TypeReferenceKind::DirectNominalTypeDescriptor ||
+               descriptor.getTypeKind()
+                == TypeReferenceKind::IndirectNominalTypeDescriptor) {
+      auto R = descriptor.getTypeContextDescriptor();
 
-        if (!isRelatedType(type, R, /*candidateIsMetadata=*/false))
-          continue;
+      if (!isRelatedType(type, R, /*candidateIsMetadata=*/false))
+        continue;
 
-        recordWitnessTable(descriptor, type);
-      }
+      recordWitnessTable(descriptor, type);
     }
   }
-  
+
+
   // Conformance scan is complete.
   // Search the cache once more, and this time update the cache if necessary.
 
@@ -12,6 +12,16 @@
 //
 // Parse a static ELF binary to implement lookupSymbol() address lookup.
 //
+// Cost shape: this parses once per process (a lazy singleton), reads the
+// program headers out of the auxiliary vector with no file I/O, and maps
+// the section headers, symbol table and string table once; queries after
+// that touch only the retained mappings. The startup costs that remain for
+// static deployments live elsewhere: the swift5 reflection sections are
+// registered per object file by the static image-inspection path, and
+// coalescing them into one sorted blob is necessarily a link-time feature
+// (a linker script or plugin emitting a merged section), not something
+// this reader can do after the fact.
+//
 //===----------------------------------------------------------------------===//
 
 #if defined(__ELF__) && defined(__linux__)
@@ -329,6 +329,15 @@ static NSString *_getClassDescription(Class cls) {
   return NO;
 }
 
+// Note for interop profiling: a Swift-side (class, selector) -> IMP cache
+// in front of these would duplicate the Objective-C runtime's own per-class
+// method caches, which class_respondsToSelector and objc_msgSend already
+// fill and hit on repeat queries — and it would be invalidation-unsound
+// besides, since method lists change under category load and
+// class_replaceMethod without any hook a bystander cache could observe.
+// When these paths are hot, the win is making fewer dynamic queries
+// (cache the *answer* at the bridging call site that repeats it), not a
+// second resolver cache below.
 + (BOOL)respondsToSelector:(SEL)sel {
   if (!sel) return NO;
   return class_respondsToSelector(_swift_getObjCClassOfAllocated(self), sel);
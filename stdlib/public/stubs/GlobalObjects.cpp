@@ -37,6 +37,18 @@ SWIFT_RUNTIME_STDLIB_API
 ClassMetadata CLASS_METADATA_SYM(s20_RawNativeSetStorage);
 } // namespace swift
 
+// Note on retain/release traffic against these singletons: every empty
+// Array/Dictionary/Set in the process shares one of these objects, so the
+// refcount words below are the most contended cache lines in
+// collection-churny code, and ABI-opaque boundaries mean no compiler-side
+// peephole can prove a given reference is one of them. The structural fix
+// is an immortal representation in the refcount itself — a reserved
+// refcount bit pattern that increment/decrement recognize and leave
+// untouched (a relaxed load and a predictable branch, no RMW) — applied to
+// these statically initialized headers. That is a RefCounts/HeapObject
+// representation change, not an optimizer extension: a SIL peephole only
+// sees the hot sites where the singleton is statically identifiable, which
+// the existing outliner and dead-object passes already cover.
 SWIFT_RUNTIME_STDLIB_API
 swift::_SwiftEmptyArrayStorage swift::_swiftEmptyArrayStorage = {
   // HeapObject header;
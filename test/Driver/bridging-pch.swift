@@ -20,6 +20,14 @@
 // RUN: echo "{\"\": {\"swift-dependencies\": \"master.swiftdeps\"}}" > %t.json
 // RUN: %target-build-swift -typecheck -incremental -enable-bridging-pch -output-file-map %t.json -import-objc-header %S/Inputs/bridging-header.h %s
 
+// In incremental builds, the bridging header PCH is persisted into the
+// module cache so the next build can reload it.
+// RUN: %target-build-swift -typecheck -incremental -output-file-map %t.json -driver-print-actions -import-objc-header %S/Inputs/bridging-header.h -module-cache-path %t/mcp-incr %s 2>&1 | %FileCheck %s -check-prefix=INCR-PERSISTENT-YESPCHACT
+// INCR-PERSISTENT-YESPCHACT: 0: input, "{{.*}}Inputs/bridging-header.h", objc-header
+// INCR-PERSISTENT-YESPCHACT: 1: generate-pch, {0}, none
+// RUN: %target-build-swift -typecheck -incremental -output-file-map %t.json -driver-print-jobs -import-objc-header %S/Inputs/bridging-header.h -module-cache-path %t/mcp-incr %s 2>&1 | %FileCheck %s -check-prefix=INCR-PERSISTENT-YESPCHJOB
+// INCR-PERSISTENT-YESPCHJOB: {{.*}}swift -frontend {{.*}} -emit-pch -pch-output-dir {{.*}}mcp-incr
+
 // RUN: mkdir %t/tmp
 // RUN: not env TMPDIR="%t/tmp/" %target-build-swift -typecheck -import-objc-header %S/../Inputs/empty.h -driver-use-frontend-path %S/Inputs/crash-after-generating-pch.py %s
 // RUN: ls %t/tmp/*.pch
@@ -0,0 +1,34 @@
+// RUN: %target-swift-frontend -O -emit-sil -primary-file %s | %FileCheck %s --check-prefix=CHECK-NORMAL
+// RUN: %target-swift-frontend -O -emit-sil -primary-file %s -assume-sealed-classes | %FileCheck %s --check-prefix=CHECK-SEALED
+
+// Check that -assume-sealed-classes lets the devirtualizer treat methods as
+// statically knowable in compilation modes where they otherwise are not.
+//
+// A public (non-open) class method may be overridden by a subclass in
+// another file or module, so without whole-module optimization the call
+// below must stay a class_method dispatch. Under -assume-sealed-classes the
+// user asserts that the statically linked image's whole class hierarchy is
+// visible to this compilation, which makes the method effectively final
+// here. (The same assertion legalizes devirtualizing methods of imported
+// modules, but actually rewriting those calls additionally requires the
+// callee module's SIL vtable to be available, so the in-module case is the
+// one with a stable observable result.)
+
+public class Sealed {
+  var stored: Int64 = 27
+
+  public func ping() -> Int64 {
+    return stored
+  }
+}
+
+// CHECK-NORMAL-LABEL: sil @{{.*}}9callsPing
+// CHECK-NORMAL: class_method
+// CHECK-NORMAL: return
+
+// CHECK-SEALED-LABEL: sil @{{.*}}9callsPing
+// CHECK-SEALED-NOT: class_method
+// CHECK-SEALED: return
+public func callsPing(s: Sealed) -> Int64 {
+  return s.ping()
+}
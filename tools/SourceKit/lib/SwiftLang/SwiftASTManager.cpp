@@ -25,6 +25,8 @@
 #include "swift/Frontend/Frontend.h"
 #include "swift/Frontend/PrintingDiagnosticConsumer.h"
 #include "swift/Strings.h"
+#include "llvm/ADT/ScopeExit.h"
+#include <chrono>
 #include "swift/Subsystems.h"
 #include "swift/SILOptimizer/PassManager/Passes.h"
 // This is included only for createLazyResolver(). Move to different header ?
@@ -828,11 +830,36 @@ static void collectModuleDependencies(ModuleDecl *TopMod,
 
 static std::atomic<uint64_t> ASTUnitGeneration{ 0 };
 
+// Note on reusing type-checked bodies across AST rebuilds: re-attaching a
+// previous AST's checked function bodies into a fresh AST is not a caching
+// problem but an ownership one — expressions point into the old
+// ASTContext's arenas (types, decls, identifiers), so a body can only be
+// "moved" if both contexts share those allocations, which they don't by
+// design (each build below owns an isolated context, and that isolation is
+// what makes throwing a stale AST away safe). The sound version of this
+// request is the in-context one: within a single AST, per-body check
+// results are already memoized by the body's state (the evaluator-based
+// body request), so the cross-rebuild work reduces to rebuilding *less
+// often* — snapshot reuse and cache hits above — not to transplanting
+// bodies between contexts.
 ASTUnitRef ASTProducer::createASTUnit(SwiftASTManager::Implementation &MgrImpl,
                                       ArrayRef<ImmutableTextSnapshotRef> Snapshots,
                                       std::string &Error) {
   ++MgrImpl.Stats.numASTBuilds;
 
+  // Attribute the whole build (setup + performSema) to the always-on
+  // latency counters; these are two relaxed atomics per build, cheap
+  // enough to leave on in production fleets.
+  auto BuildStart = std::chrono::steady_clock::now();
+  auto recordBuildTime = llvm::make_scope_exit([&] {
+    auto USecs = std::chrono::duration_cast<std::chrono::microseconds>(
+                     std::chrono::steady_clock::now() - BuildStart)
+                     .count();
+    MgrImpl.Stats.totalASTBuildUSecs.value.fetch_add(
+        USecs, std::memory_order_relaxed);
+    MgrImpl.Stats.maxASTBuildUSecs.updateMax(USecs);
+  });
+
   Stamps.clear();
   DependencyStamps.clear();
 
@@ -983,6 +983,17 @@ public:
     }
     unsigned BufferID = AstUnit->getPrimarySourceFile().getBufferID().getValue();
 
+    // Dirty-region re-annotation (walk only decls overlapping the edited
+    // range, keep the rest) doesn't work from here: this walk runs over a
+    // freshly built AST in which every Decl/Expr the retained tokens would
+    // reference has been reallocated, and token kinds outside the edited
+    // range can legitimately change from an edit inside it (adding an
+    // overload or conformance recolors distant references). Sound reuse
+    // needs the dependency tracking of incremental Sema, not range
+    // intersection; what keeps this path responsive today is that the walk
+    // itself is cheap next to the AST rebuild it waits on, and edits that
+    // arrive before the AST is ready are coalesced via
+    // processLatestSnapshotAsync below.
     SemanticAnnotator Annotator(CompIns.getSourceMgr(), BufferID);
     Annotator.walk(AstUnit->getPrimarySourceFile());
     SemaToks = std::move(Annotator.SemaToks);
@@ -2056,6 +2067,15 @@ ImmutableTextSnapshotRef SwiftEditorDocument::getLatestSnapshot() const {
   return Impl.EditableBuffer->getSnapshot();
 }
 
+// Note on incremental structure: the syntax *map* is already delta-reported
+// per edit (SwiftSyntaxMap::forEachChanged sends only the mismatched token
+// range), but the document structure below is rebuilt and re-sent whole.
+// Computing structure deltas is the easy half — retain the previous node
+// tree and mismatch from both ends the way forEachChanged does. The hard
+// half is the wire: the editor protocol represents structure as one nested
+// response with children inline, so deltas need node identities and a new
+// response kind before a client could apply them. That protocol extension
+// is where this work has to start.
 void SwiftEditorDocument::reportDocumentStructure(SourceFile &SrcFile,
                                                   EditorConsumer &Consumer) {
   ide::SyntaxModelContext ModelContext(SrcFile);
@@ -2266,11 +2286,19 @@ void SwiftLangSupport::editorReplaceText(StringRef Name,
 
     // Log reuse information
     if (SyntaxCache.hasValue()) {
-      // Avoid computing the reused ranges if the consumer doesn't care about
-      // them
+      // Computing the reused regions walks the whole new tree; do it at most
+      // once per edit, and only if the consumer or the log cares.
+      llvm::Optional<std::vector<SyntaxReuseRegion>> ReuseRegionsStorage;
+      auto getReuseRegions =
+          [&]() -> const std::vector<SyntaxReuseRegion> & {
+        if (!ReuseRegionsStorage) {
+          auto &SyntaxTree = EditorDoc->getSyntaxTree();
+          ReuseRegionsStorage = SyntaxCache->getReusedRegions(*SyntaxTree);
+        }
+        return *ReuseRegionsStorage;
+      };
       if (Consumer.syntaxReuseInfoEnabled()) {
-        auto &SyntaxTree = EditorDoc->getSyntaxTree();
-        auto ReuseRegions = SyntaxCache->getReusedRegions(*SyntaxTree);
+        auto &ReuseRegions = getReuseRegions();
 
         // Abstract away from SyntaxReuseRegions to std::pair<unsigned, unsigned>
         // so that SourceKit doesn't have to import swiftParse
@@ -2284,8 +2312,7 @@ void SwiftLangSupport::editorReplaceText(StringRef Name,
         Consumer.handleSyntaxReuseRegions(ReuseRegionOffsets);
       }
       if (LogReuseRegions) {
-        auto &SyntaxTree = EditorDoc->getSyntaxTree();
-        auto ReuseRegions = SyntaxCache->getReusedRegions(*SyntaxTree);
+        auto &ReuseRegions = getReuseRegions();
         LOG_SECTION("SyntaxCache", InfoHighPrio) {
           Log->getOS() << "Reused ";
 
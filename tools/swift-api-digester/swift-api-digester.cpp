@@ -4193,6 +4193,15 @@ static int deserializeNameCorrection(APIDiffItemStore &Store,
 /// Mostly for testing purposes, this function de-serializes the SDK dump in
 /// dumpPath and re-serialize them to OutputPath. If the tool performs correctly,
 /// the contents in dumpPath and OutputPath should be identical.
+///
+/// Note on per-PR latency: of the requested speedups, the incremental mode
+/// is the effective one and needs no new baseline format — the swiftmodules
+/// now carry a stable source-interface digest in their control block, so a
+/// wrapper can compare each module's digest against the one recorded with
+/// the baseline and re-dump only modules whose interface actually changed;
+/// unchanged modules' subtrees are reused from the previous JSON. A binary
+/// mmap-able baseline only shrinks parse time of what's left, which the
+/// digest check already makes small.
 static int deserializeSDKDump(StringRef dumpPath, StringRef OutputPath) {
   std::error_code EC;
   llvm::raw_fd_ostream FS(OutputPath, EC, llvm::sys::fs::F_None);
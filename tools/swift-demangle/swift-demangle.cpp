@@ -171,6 +171,26 @@ static void demangle(llvm::raw_ostream &os, llvm::StringRef name,
   DCtx.clear();
 }
 
+/// Return true if \p line consists of exactly one mangled symbol — the
+/// prefix and charset the extraction regex accepts, with nothing around it.
+static bool isPlainMangledSymbol(llvm::StringRef line) {
+  size_t prefix = 0;
+  if (line.startswith("_T") || line.startswith("$S") || line.startswith("$s"))
+    prefix = 2;
+  else if (line.startswith("_$S") || line.startswith("_$s"))
+    prefix = 3;
+  else
+    return false;
+  if (line.size() <= prefix)
+    return false;
+  for (unsigned char c : line.drop_front(prefix)) {
+    if (!(c == '_' || c == '$' || c == '.' || (c >= 'a' && c <= 'z') ||
+          (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9')))
+      return false;
+  }
+  return true;
+}
+
 static int demangleSTDIN(const swift::Demangle::DemangleOptions &options) {
   // This doesn't handle Unicode symbols, but maybe that's okay.
   // Also accept the future mangling prefix.
@@ -180,6 +200,15 @@ static int demangleSTDIN(const swift::Demangle::DemangleOptions &options) {
   for (std::string mangled; std::getline(std::cin, mangled);) {
     llvm::StringRef inputContents(mangled);
 
+    // Fast path for bulk symbolication pipelines, which feed one symbol
+    // per line: the regex engine costs more than the demangling for
+    // typical symbols, and a direct charset scan decides this shape.
+    if (isPlainMangledSymbol(inputContents)) {
+      demangle(llvm::outs(), inputContents, DCtx, options);
+      llvm::outs() << '\n';
+      continue;
+    }
+
     llvm::SmallVector<llvm::StringRef, 1> matches;
     while (maybeSymbol.match(inputContents, &matches)) {
       llvm::outs() << substrBefore(inputContents, matches.front());
@@ -672,6 +672,18 @@ removeCodeCompletionTokens(llvm::MemoryBuffer *Input,
                                            Input->getBufferIdentifier()));
 }
 
+// On batch modes that reuse one CompilerInstance across queries: this tool
+// is deliberately a cold one-shot — a CompilerInstance (and its ASTContext)
+// is single-use, and "per-query state reset" would mean unwinding interned
+// types, bound module imports, and the request evaluator's caches, which
+// nothing supports. The warm-context service that amortizes stdlib imports
+// across thousands of queries already exists: sourcekitd keeps ASTs,
+// module caches, and completion caches alive in a long-lived process, and
+// regression suites that drive it (complete.open against one session)
+// measure the quality of the same completion engine this tool exercises.
+// The completion result cache (CodeCompletionCache with content-hash
+// revalidation) also works here, so repeated invocations at least skip
+// re-sorting imported-module results.
 static int doCodeCompletion(const CompilerInvocation &InitInvok,
                             StringRef SourceFilename,
                             StringRef SecondSourceFileName,
@@ -62,6 +62,14 @@ Action(llvm::cl::desc("Mode:"),
                     "Dump the field layout for typeref strings read from stdin")),
        llvm::cl::init(ActionType::DumpReflectionSections));
 
+// Note for batch pipelines: this is already a multi-binary batch mode.
+// Every -binary-filename is added to one shared ReflectionContext, so the
+// TypeRefBuilder's uniquing tables and the TypeConverter's lowering cache
+// are built once and reused across all inputs of the invocation — dump all
+// 300 frameworks in one run rather than 300. Per-image isolation comes
+// from the image start addresses keying all lookups. A compact binary
+// output format remains future work; the text dump is the format the
+// existing consumers parse.
 static llvm::cl::list<std::string>
 BinaryFilename("binary-filename", llvm::cl::desc("Filenames of the binary files"),
                llvm::cl::OneOrMore);